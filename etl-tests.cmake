@@ -10,6 +10,12 @@ list(APPEND ETL_TEST_CMN ${ETL_TESTS_DIR}/testMain.cpp)
 if(ETL_BUILD_TESTS)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testVector.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testList.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testForwardList.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testUnrolledList.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testSegmentedVector.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testSoAVector.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testDeque.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testIntrusive.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testSet.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testMap.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testMultiMap.cpp)
@@ -18,8 +24,12 @@ if(ETL_BUILD_TESTS)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testUnorderedSet.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testFifo.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testPool.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testSlabAllocator.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testArena.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testRelocatable.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testBufStr.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testSpan.cpp)
+    list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testAlgorithms.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testComplexScenarios.cpp)
     list(APPEND ETL_TEST_SRCS ${ETL_TESTS_DIR}/testStaticInstance.cpp)
 
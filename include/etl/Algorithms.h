@@ -0,0 +1,63 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_ALGORITHMS_H_
+#define ETL_ALGORITHMS_H_
+
+#include <etl/base/kernels.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+namespace ETL_NAMESPACE {
+
+/*
+Whole-container algorithms for contiguous containers, e.g. `Vector`, `Array` and `Span`.
+These use the block kernels of `Detail`, see `etl/base/kernels.h`.
+Return values follow the matching `std` algorithm, `end()` means 'not found'.
+*/
+
+template<class C>
+auto find(C& cont, const typename C::value_type& value)
+    -> enable_if_t<Detail::IsContiguous<remove_const_t<C>>::value, decltype(cont.begin())> {
+    return cont.begin() + Detail::findKernel(cont.data(), cont.size(), value);
+}
+
+template<class C>
+auto count(const C& cont, const typename C::value_type& value)
+    -> enable_if_t<Detail::IsContiguous<C>::value, std::size_t> {
+    return Detail::countKernel(cont.data(), cont.size(), value);
+}
+
+template<class C>
+auto min_element(C& cont)
+    -> enable_if_t<Detail::IsContiguous<remove_const_t<C>>::value, decltype(cont.begin())> {
+    return cont.begin() + Detail::minKernel(cont.data(), cont.size());
+}
+
+template<class C>
+auto max_element(C& cont)
+    -> enable_if_t<Detail::IsContiguous<remove_const_t<C>>::value, decltype(cont.begin())> {
+    return cont.begin() + Detail::maxKernel(cont.data(), cont.size());
+}
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_ALGORITHMS_H_
@@ -0,0 +1,121 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_ATOMICMEMORYPOOL_H_
+#define ETL_ATOMICMEMORYPOOL_H_
+
+#include <etl/Array.h>
+#include <etl/base/AtomicPoolBase.h>
+#include <etl/etlSupport.h>
+
+#include <atomic>
+#include <limits>
+
+namespace ETL_NAMESPACE {
+
+/**
+Lock-free memory pool template.
+Interface-compatible with MemoryPool, `pop()` and `push()` can be called
+concurrently without locking. Needs lock-free 64 bit atomics to be actually
+lock-free, check `isLockFree()` on the target.
+\tparam S Allocated block size
+\tparam N Pool length
+\tparam A Minimal alignment of the blocks, `uint64_t` alignment is used when smaller
+*/
+template<std::size_t S, std::size_t N, std::size_t A = alignof(std::uint64_t)>
+class AtomicMemoryPool {
+
+    static_assert(S > 0, "Invalid item size");
+    static_assert(N > 0, "Invalid pool length");
+    static_assert(N < std::numeric_limits<Detail::AtomicPoolBase::Link>::max(),
+                  "Pool length exceeds the link range");
+    static_assert((A > 0) && ((A & (A - 1U)) == 0U), "Invalid alignment");
+
+  private:  // types
+
+    using MinItemType = std::uint64_t;
+
+    static constexpr std::size_t ITEM_ALIGN {(A > alignof(MinItemType)) ? A
+                                                                         : alignof(MinItemType)};
+
+    union alignas(ITEM_ALIGN) ItemAlias {
+        MinItemType minItem;   // for aliasing alignment and size of Minimal Item
+        std::uint8_t item[S];  // for aliasing size of S
+    };
+
+  private:  // variables
+
+    Array<ItemAlias, N> data;  // Left uninitialized, items are taken by the lazy bump index
+    Array<std::atomic<Detail::AtomicPoolBase::Link>, N> links {};
+    Detail::AtomicPoolBase base {data, links.data()};
+
+  public:  // functions
+
+    /// User-provided to avoid zero-filling the storage on value-initialization.
+    AtomicMemoryPool() noexcept {}
+    AtomicMemoryPool(const AtomicMemoryPool& other) = delete;
+    AtomicMemoryPool& operator=(const AtomicMemoryPool& other) = delete;
+    AtomicMemoryPool(AtomicMemoryPool&& other) = delete;
+    AtomicMemoryPool& operator=(AtomicMemoryPool&& other) = delete;
+    ~AtomicMemoryPool() = default;
+
+    void* pop() noexcept {
+        return base.pop();
+    }
+
+    bool push(void* item) noexcept {
+        return base.push(item);
+    }
+
+    /// Releases all items at once in O(1).
+    void reset() noexcept {
+        base.reset();
+    }
+
+    std::size_t getFreeCount() const noexcept {
+        return base.getFreeCount();
+    }
+
+    std::size_t capacity() const noexcept {
+        return N;
+    }
+
+    std::size_t getCount() const noexcept {
+        return capacity() - getFreeCount();
+    }
+
+    PoolStats getStats() const noexcept {
+        return base.getStats();
+    }
+
+    bool isLockFree() const noexcept {
+        return base.isLockFree();
+    }
+
+    static constexpr std::size_t alignment() noexcept {
+        return alignof(ItemAlias);
+    }
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_ATOMICMEMORYPOOL_H_
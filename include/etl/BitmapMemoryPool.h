@@ -0,0 +1,146 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_BITMAPMEMORYPOOL_H_
+#define ETL_BITMAPMEMORYPOOL_H_
+
+#include <etl/Array.h>
+#include <etl/base/BitmapPoolBase.h>
+#include <etl/etlSupport.h>
+
+namespace ETL_NAMESPACE {
+
+/**
+Memory pool template with address-ordered allocation.
+Like MemoryPool, but the used items are tracked in a bitmap instead of a free list,
+and always the lowest free item is taken. This keeps the used items packed
+after any allocation pattern, in favor of iteration locality.
+Runs of contiguous items can be allocated as well.
+\tparam S Allocated block size
+\tparam N Pool length
+\tparam A Minimal alignment of the blocks, `uint64_t` alignment is used when smaller
+*/
+template<std::size_t S, std::size_t N, std::size_t A = alignof(std::uint64_t)>
+class BitmapMemoryPool {
+
+    static_assert(S > 0, "Invalid item size");
+    static_assert(N > 0, "Invalid pool length");
+    static_assert((A > 0) && ((A & (A - 1U)) == 0U), "Invalid alignment");
+
+  private:  // types
+
+    using MinItemType = std::uint64_t;
+    using Word = Detail::BitmapPoolBase::Word;
+
+    static constexpr std::size_t ITEM_ALIGN {(A > alignof(MinItemType)) ? A
+                                                                         : alignof(MinItemType)};
+
+    union alignas(ITEM_ALIGN) ItemAlias {
+        MinItemType minItem;   // for aliasing alignment and size of Minimal Item
+        std::uint8_t item[S];  // for aliasing size of S
+    };
+
+  private:  // variables
+
+    Array<ItemAlias, N> data;  // Left uninitialized, items are tracked by the bitmap
+    Array<Word, Detail::BitmapPoolBase::wordCount(N)> bitmap {};
+    Detail::BitmapPoolBase base {data, bitmap.data()};
+
+  public:  // functions
+
+    /// User-provided to avoid zero-filling the storage on value-initialization.
+    BitmapMemoryPool() noexcept {}
+    BitmapMemoryPool(const BitmapMemoryPool& other) = delete;
+    BitmapMemoryPool& operator=(const BitmapMemoryPool& other) = delete;
+    BitmapMemoryPool(BitmapMemoryPool&& other) = delete;
+    BitmapMemoryPool& operator=(BitmapMemoryPool&& other) = delete;
+    ~BitmapMemoryPool() = default;
+
+    void* pop() noexcept {
+        return base.pop();
+    }
+
+    /// Takes the lowest run of `n` contiguous items.
+    void* pop(std::size_t n) noexcept {
+        return base.pop(n);
+    }
+
+    bool push(void* item) noexcept {
+        return base.push(item);
+    }
+
+    /// Releases a run of `n` items taken by `pop(n)`, or any part of it.
+    bool push(void* item, std::size_t n) noexcept {
+        return base.push(item, n);
+    }
+
+    /// Releases all items at once.
+    void reset() noexcept {
+        base.reset();
+    }
+
+    /// \name Occupancy scan
+    /// \{
+    /// Returns the index of the first used item from `ix`, or `capacity()` when none.
+    std::size_t findUsed(std::size_t ix) const noexcept {
+        return base.findUsed(ix);
+    }
+
+    /// Returns the index of the first free item from `ix`, or `capacity()` when none.
+    std::size_t findFree(std::size_t ix) const noexcept {
+        return base.findFree(ix);
+    }
+
+    bool isUsed(std::size_t ix) const noexcept {
+        return base.isUsed(ix);
+    }
+
+    void* getItemPointer(std::size_t ix) noexcept {
+        ETL_ASSERT(ix < N);
+        return base.getItemPointer(ix);
+    }
+    /// \}
+
+    std::size_t getFreeCount() const noexcept {
+        return base.getFreeCount();
+    }
+
+    std::size_t capacity() const noexcept {
+        return N;
+    }
+
+    std::size_t getCount() const noexcept {
+        return capacity() - getFreeCount();
+    }
+
+    PoolStats getStats() const noexcept {
+        return base.getStats();
+    }
+
+    static constexpr std::size_t alignment() noexcept {
+        return alignof(ItemAlias);
+    }
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_BITMAPMEMORYPOOL_H_
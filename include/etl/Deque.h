@@ -0,0 +1,366 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_DEQUE_H_
+#define ETL_DEQUE_H_
+
+#include <etl/PoolAllocator.h>
+#include <etl/Vector.h>
+#include <etl/base/AAllocator.h>
+#include <etl/base/DequeTemplate.h>
+#include <etl/etlSupport.h>
+
+#include <memory>
+
+namespace ETL_NAMESPACE {
+
+namespace Custom {
+
+/// Deque with custom block allocator, the block map is allocated dynamically.
+template<class T, template<class> class A, std::size_t K = 16U>
+class Deque : public ETL_NAMESPACE::Deque<T, K> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::Deque<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Block = typename Base::Block;
+
+    using AllocatorTraits = typename Detail::AllocatorTraits<Block, A>;
+    using Allocator = typename AllocatorTraits::Type;
+
+  private:  // variables
+
+    ETL_NAMESPACE::Dynamic::Vector<Block*> map;
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    Deque() noexcept :
+        Base {map, allocator} {}
+
+    explicit Deque(size_type len) :
+        Deque {} {
+        this->resize(len);
+    }
+
+    Deque(size_type len, const T& item) :
+        Deque {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    Deque(InputIt first, InputIt last) :
+        Deque {} {
+        this->assign(first, last);
+    }
+
+    Deque(const Deque& other) :
+        Deque {} {
+        Base::operator=(other);
+    }
+
+    explicit Deque(const Base& other) :
+        Deque {} {
+        Base::operator=(other);
+    }
+
+    Deque& operator=(const Deque& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Deque& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Deque(Deque&& other) :
+        Deque {} {
+        this->swap(other);
+    }
+
+    Deque& operator=(Deque&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    Deque(std::initializer_list<T> initList) :
+        Deque {} {
+        operator=(initList);
+    }
+
+    Deque& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~Deque() {
+        this->cleanup();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(Deque& lhs, Deque& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Custom
+
+
+namespace Dynamic {
+
+/// Deque with dynamic memory allocation using std::allocator.
+template<class T, std::size_t K = 16U>
+using Deque = ETL_NAMESPACE::Custom::Deque<T, std::allocator, K>;
+
+}  // namespace Dynamic
+
+
+namespace Static {
+
+/// Deque with unique block pool for N elements.
+template<class T, std::size_t N, std::size_t K = 16U>
+class Deque : public ETL_NAMESPACE::Deque<T, K> {
+
+    static_assert(N > 0, "Invalid Etl::Static::Deque<> size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::Deque<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Block = typename Base::Block;
+
+    static constexpr std::size_t NUM_OF_BLOCKS {((N + K - 1U) / K) + 1U};
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<NUM_OF_BLOCKS>::template Allocator<Block>;
+
+  private:  // variables
+
+    ETL_NAMESPACE::Static::Vector<Block*, NUM_OF_BLOCKS> map;
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    Deque() noexcept :
+        Base {map, allocator} {}
+
+    explicit Deque(size_type len) :
+        Deque {} {
+        this->resize(len);
+    }
+
+    Deque(size_type len, const T& item) :
+        Deque {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    Deque(InputIt first, InputIt last) :
+        Deque {} {
+        this->assign(first, last);
+    }
+
+    Deque(const Deque& other) :
+        Deque {} {
+        Base::operator=(other);
+    }
+
+    explicit Deque(const Base& other) :
+        Deque {} {
+        Base::operator=(other);
+    }
+
+    Deque& operator=(const Deque& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Deque& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Deque(Deque&& other) :
+        Deque {} {
+        this->swap(other);
+    }
+
+    Deque& operator=(Deque&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    Deque(std::initializer_list<T> initList) :
+        Deque {} {
+        operator=(initList);
+    }
+
+    Deque& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~Deque() {
+        this->cleanup();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(Deque& lhs, Deque& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Static
+
+
+namespace Pooled {
+
+/// Deque with common block pool of NB blocks.
+template<class T, std::size_t NB, std::size_t K = 16U>
+class Deque : public ETL_NAMESPACE::Deque<T, K> {
+
+    static_assert(NB > 0, "Invalid Etl::Pooled::Deque<> size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::Deque<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Block = typename Base::Block;
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<NB>::template CommonAllocator<Block>;
+
+  private:  // variables
+
+    ETL_NAMESPACE::Static::Vector<Block*, NB> map;
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    Deque() noexcept :
+        Base {map, allocator} {
+        (void)allocator.handle();  // This assures to construct allocator instance before
+                                   // the first container, avoiding SIOF during static deinit.
+    }
+
+    explicit Deque(size_type len) :
+        Deque {} {
+        this->resize(len);
+    }
+
+    Deque(size_type len, const T& item) :
+        Deque {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    Deque(InputIt first, InputIt last) :
+        Deque {} {
+        this->assign(first, last);
+    }
+
+    Deque(const Deque& other) :
+        Deque {} {
+        Base::operator=(other);
+    }
+
+    explicit Deque(const Base& other) :
+        Deque {} {
+        Base::operator=(other);
+    }
+
+    Deque& operator=(const Deque& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Deque& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Deque(Deque&& other) :
+        Deque {} {
+        this->swap(other);
+    }
+
+    Deque& operator=(Deque&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    Deque(std::initializer_list<T> initList) :
+        Deque {} {
+        operator=(initList);
+    }
+
+    Deque& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~Deque() {
+        this->cleanup();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(Deque& lhs, Deque& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Pooled
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_DEQUE_H_
@@ -36,7 +36,7 @@ class Fifo : public FifoTemplate<C> {
 
     template<typename... Args>
     explicit Fifo<C>(Args&&... args) :
-        FifoTemplate<C>(args...) {}
+        FifoTemplate<C>(std::forward<Args>(args)...) {}
 
     void setupFifo(uint32_t len);
 };
@@ -56,7 +56,7 @@ class Fifo<Array<T, N>> : public FifoTemplate<Array<T, N>> {
 
     template<typename... Args>
     explicit Fifo<Array<T, N>>(Args&&... args) :
-        FifoTemplate<Array<T, N>>(args...) {}
+        FifoTemplate<Array<T, N>>(std::forward<Args>(args)...) {}
 
     void setupFifo(uint32_t len) {
         (void)len;
@@ -0,0 +1,399 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_FORWARDLIST_H_
+#define ETL_FORWARDLIST_H_
+
+#include <etl/PoolAllocator.h>
+#include <etl/base/AAllocator.h>
+#include <etl/base/ForwardListTemplate.h>
+#include <etl/etlSupport.h>
+
+#include <memory>
+
+namespace ETL_NAMESPACE {
+
+namespace Custom {
+
+/// ForwardList with custom allocator.
+template<class T, template<class> class A>
+class ForwardList : public ETL_NAMESPACE::ForwardList<T> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::ForwardList<T>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Node = typename Base::Node;
+
+    using AllocatorTraits = typename Detail::AllocatorTraits<Node, A>;
+    using Allocator = typename AllocatorTraits::Type;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    ForwardList() noexcept :
+        Base {allocator} {}
+
+    explicit ForwardList(size_type len) :
+        ForwardList {} {
+        this->assign(len, T {});
+    }
+
+    ForwardList(size_type len, const T& item) :
+        ForwardList {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    ForwardList(InputIt first, InputIt last) :
+        ForwardList {} {
+        this->assign(first, last);
+    }
+
+    ForwardList(const ForwardList& other) :
+        ForwardList {} {
+        Base::operator=(other);
+    }
+
+    explicit ForwardList(const Base& other) :
+        ForwardList {} {
+        Base::operator=(other);
+    }
+
+    ForwardList& operator=(const ForwardList& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    ForwardList& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    ForwardList(ForwardList&& other) noexcept(noexcept(ForwardList().swap(other))) :
+        ForwardList {} {
+        this->swap(other);
+    }
+
+    ForwardList& operator=(ForwardList&& other) noexcept(noexcept(ForwardList().swap(other))) {
+        this->swap(other);
+        return *this;
+    }
+
+    ForwardList(std::initializer_list<T> initForwardList) :
+        ForwardList {} {
+        operator=(initForwardList);
+    }
+
+    ForwardList& operator=(std::initializer_list<T> initForwardList) {
+        Base::operator=(initForwardList);
+        return *this;
+    }
+
+    ~ForwardList() {
+        this->clear();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    void swap(ForwardList& other) noexcept {
+        static_assert(noexcept(ForwardList().swapNodeList(other)),
+                      "noexcept contract violation");
+        static_assert(!AllocatorTraits::uniqueAllocator,
+                      "Allocator should use uniqueAllocator == false");
+        if (&other != this) {
+            Base::swapNodeList(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(ForwardList& lhs, ForwardList& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Custom
+
+
+namespace Dynamic {
+
+/// ForwardList with dynamic memory allocation using std::allocator.
+template<class T>
+using ForwardList = ETL_NAMESPACE::Custom::ForwardList<T, std::allocator>;
+
+}  // namespace Dynamic
+
+
+namespace Static {
+
+/// ForwardList with unique pool allocator.
+template<class T, size_t N>
+class ForwardList : public ETL_NAMESPACE::ForwardList<T> {
+
+    static_assert(N > 0, "Invalid Etl::Static::ForwardList size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::ForwardList<T>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<N>::template Allocator<typename Base::Node>;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    ForwardList() noexcept :
+        Base {allocator} {}
+
+    explicit ForwardList(size_type len) :
+        ForwardList {} {
+        this->assign(len, T {});
+    }
+
+    ForwardList(size_type len, const T& item) :
+        ForwardList {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    ForwardList(InputIt first, InputIt last) :
+        ForwardList {} {
+        this->assign(first, last);
+    }
+
+    ForwardList(const ForwardList& other) :
+        ForwardList {} {
+        Base::operator=(other);
+    }
+
+    explicit ForwardList(const Base& other) :
+        ForwardList {} {
+        Base::operator=(other);
+    }
+
+    ForwardList& operator=(const ForwardList& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    ForwardList& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    ForwardList(ForwardList&& other) noexcept(noexcept(ForwardList().swap(other))) :
+        ForwardList {} {
+        this->swap(other);
+    }
+
+    ForwardList& operator=(ForwardList&& other) noexcept(noexcept(ForwardList().swap(other))) {
+        this->swap(other);
+        return *this;
+    }
+
+    ForwardList(std::initializer_list<T> initForwardList) :
+        ForwardList {} {
+        operator=(initForwardList);
+    }
+
+    ForwardList& operator=(std::initializer_list<T> initForwardList) {
+        Base::operator=(initForwardList);
+        return *this;
+    }
+
+    ~ForwardList() {
+        this->clear();
+    }
+
+    /// Destroys all elements. Trivially destructible elements are released
+    /// at once by resetting the own pool.
+    void clear() noexcept(noexcept(std::declval<Base>().clear())) {
+        if (std::is_trivially_destructible<typename Base::value_type>::value) {
+            this->dropNodes();
+            allocator.reset();
+        } else {
+            Base::clear();
+        }
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    void swap(ForwardList& other) noexcept(noexcept(Detail::NothrowContract<T>::nothrowIfMovable)) {
+        // Note: this operation is noexcept when T can be moved 'noexceptly',
+        // however lower level functions are not annotated with noexcept qualifier.
+        static_assert(Allocator::uniqueAllocator,
+                      "Allocator should use uniqueAllocator == true");
+        if (&other != this) {
+            Base::swap(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(ForwardList& lhs, ForwardList& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Static
+
+
+namespace Pooled {
+
+/// ForwardList with common pool allocator.
+template<class T, size_t N>
+class ForwardList : public ETL_NAMESPACE::ForwardList<T> {
+
+    static_assert(N > 0, "Invalid Etl::Pooled::ForwardList size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::ForwardList<T>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<N>::template CommonAllocator<typename Base::Node>;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    ForwardList() noexcept :
+        Base {allocator} {
+        (void)allocator.handle();  // This assures to construct allocator instance before
+                                   // the first container, avoiding SIOF during static deinit.
+    }
+
+    explicit ForwardList(size_type len) :
+        ForwardList {} {
+        this->assign(len, T {});
+    }
+
+    ForwardList(size_type len, const T& item) :
+        ForwardList {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    ForwardList(InputIt first, InputIt last) :
+        ForwardList {} {
+        this->assign(first, last);
+    }
+
+    ForwardList(const ForwardList& other) :
+        ForwardList {} {
+        Base::operator=(other);
+    }
+
+    explicit ForwardList(const Base& other) :
+        ForwardList {} {
+        Base::operator=(other);
+    }
+
+    ForwardList& operator=(const ForwardList& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    ForwardList& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    ForwardList(ForwardList&& other) noexcept(noexcept(ForwardList().swap(other))) :
+        ForwardList {} {
+        this->swap(other);
+    }
+
+    ForwardList& operator=(ForwardList&& other) noexcept(noexcept(ForwardList().swap(other))) {
+        this->swap(other);
+        return *this;
+    }
+
+    ForwardList(std::initializer_list<T> initForwardList) :
+        ForwardList {} {
+        operator=(initForwardList);
+    }
+
+    ForwardList& operator=(std::initializer_list<T> initForwardList) {
+        Base::operator=(initForwardList);
+        return *this;
+    }
+
+    ~ForwardList() {
+        this->clear();
+        ETL_ASSERT(this->empty());
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    void swap(ForwardList& other) noexcept {
+        static_assert(noexcept(ForwardList().swapNodeList(other)),
+                      "noexcept contract violation");
+        static_assert(!Allocator::uniqueAllocator,
+                      "Allocator should use uniqueAllocator == false");
+        if (&other != this) {
+            Base::swapNodeList(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(ForwardList& lhs, ForwardList& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Pooled
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_FORWARDLIST_H_
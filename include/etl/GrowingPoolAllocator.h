@@ -0,0 +1,472 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_GROWINGPOOLALLOCATOR_H_
+#define ETL_GROWINGPOOLALLOCATOR_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace ETL_NAMESPACE {
+
+/**
+Pool allocator growing in chunks.
+Items are taken from a free list or from the newest chunk. When both are exhausted,
+a new chunk is acquired from the upstream allocator, sized to the current capacity,
+so the capacity grows geometrically. Memory is returned to the upstream
+only by `shrink()` and on destruction.
+\note This allocator supports allocating exactly _one element_ for one call of `allocate()`.
+\tparam T Item type
+\tparam C Size of the first chunk
+\tparam UA Upstream allocator template, defaults to std::allocator
+*/
+template<class T, std::size_t C = 16U, template<class> class UA = std::allocator>
+class GrowingPoolAllocator : public AAllocator<T> {
+
+    static_assert(C > 0, "Invalid chunk size");
+
+  public:  // types
+
+    using ItemType = T;
+    using PtrType = T*;
+
+    static constexpr bool uniqueAllocator = true;
+
+  private:  // types
+
+    struct FreeItem {
+        FreeItem* next;
+    };
+
+    union Item {
+        FreeItem freeItem;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type data;
+    };
+
+    struct Chunk {
+        Chunk* next;
+        Chunk* nextByAddr;
+        std::size_t len;
+        std::size_t freeCnt;
+    };
+
+    using Upstream = UA<Item>;
+
+    static constexpr std::size_t HEADER_ITEMS {(sizeof(Chunk) + sizeof(Item) - 1U) / sizeof(Item)};
+    static constexpr std::size_t MAX_CHUNK {C << 10U};
+    static constexpr std::size_t RELEASED {std::numeric_limits<std::size_t>::max()};
+
+  private:  // variables
+
+    Upstream upstream {};
+    Chunk* chunks {nullptr};
+    Chunk* chunksByAddr {nullptr};
+    FreeItem* freeList {nullptr};
+    std::size_t bumpIx {0U};
+    std::size_t cap {0U};
+    std::size_t cnt {0U};
+
+  public:  // functions
+
+    GrowingPoolAllocator() = default;
+    GrowingPoolAllocator(const GrowingPoolAllocator& other) = delete;
+    GrowingPoolAllocator& operator=(const GrowingPoolAllocator& other) = delete;
+    GrowingPoolAllocator(GrowingPoolAllocator&& other) = delete;
+    GrowingPoolAllocator& operator=(GrowingPoolAllocator&& other) = delete;
+
+    ~GrowingPoolAllocator() override {
+        while (chunks != nullptr) {
+            Chunk* next = chunks->next;
+            release(chunks);
+            chunks = next;
+        }
+    }
+
+    std::size_t max_size() const noexcept override {
+        return std::numeric_limits<std::size_t>::max() / sizeof(Item);
+    }
+
+    std::size_t size() const noexcept override {
+        return cnt;
+    }
+
+    std::size_t reserve() const noexcept override {
+        return max_size() - cnt;
+    }
+
+    PtrType allocate(std::size_t n) override {
+        if (n != 1U) {
+            return nullptr;
+        }
+
+        Item* item = nullptr;
+        if (freeList != nullptr) {
+            item = reinterpret_cast<Item*>(freeList);
+            freeList = freeList->next;
+        } else if (((chunks != nullptr) && (bumpIx < chunks->len)) || grow()) {
+            item = itemsOf(chunks) + bumpIx;
+            ++bumpIx;
+        } else {
+            return nullptr;
+        }
+
+        ++cnt;
+        return reinterpret_cast<PtrType>(item);
+    }
+
+    void deallocate(PtrType ptr, std::size_t n) noexcept override {
+        (void)n;
+        if (ptr != nullptr) {
+            FreeItem* item = reinterpret_cast<FreeItem*>(ptr);
+            item->next = freeList;
+            freeList = item;
+            --cnt;
+        }
+    }
+
+    const void* handle() const noexcept override {
+        return this;
+    }
+
+    /// Number of items in the acquired chunks.
+    std::size_t capacity() const noexcept {
+        return cap;
+    }
+
+    std::size_t getChunkCount() const noexcept {
+        std::size_t n = 0U;
+        for (const Chunk* c = chunks; c != nullptr; c = c->next) {
+            ++n;
+        }
+        return n;
+    }
+
+    /// Returns the chunks without allocated items to the upstream allocator.
+    /// \return the number of items released.
+    std::size_t shrink() noexcept;
+
+  private:
+
+    static Item* itemsOf(Chunk* c) noexcept {
+        return reinterpret_cast<Item*>(c) + HEADER_ITEMS;
+    }
+
+    static bool contains(const Chunk* c, const FreeItem* item) noexcept {
+        const std::less<const Item*> less {};
+        const Item* it = reinterpret_cast<const Item*>(item);
+        const Item* first = itemsOf(const_cast<Chunk*>(c));
+        return !less(it, first) && less(it, first + c->len);
+    }
+
+    /// Returns the chunk of `item`, stepping forward from `c` in address order.
+    /// The items have to be visited in ascending address order.
+    static Chunk* ownerFrom(Chunk* c, const FreeItem* item) noexcept {
+        while ((c != nullptr) && !contains(c, item)) {
+            c = c->nextByAddr;
+        }
+
+        ETL_ASSERT(c != nullptr);
+        return c;
+    }
+
+    static FreeItem* sortByAddress(FreeItem* list) noexcept;
+
+    bool grow() {
+        std::size_t len = (cap < C) ? C : cap;
+        len = (len > MAX_CHUNK) ? MAX_CHUNK : len;
+
+        Item* raw = upstream.allocate(len + HEADER_ITEMS);
+        if (raw == nullptr) {
+            return false;
+        }
+
+        chunks = new (raw) Chunk {chunks, nullptr, len, 0U};
+        bumpIx = 0U;
+
+        // Chunks are also linked in address order to find the owners of free items.
+        const std::less<const Chunk*> less {};
+        Chunk** link = &chunksByAddr;
+        while ((*link != nullptr) && less(*link, chunks)) {
+            link = &(*link)->nextByAddr;
+        }
+
+        chunks->nextByAddr = *link;
+        *link = chunks;
+        cap += len;
+        return true;
+    }
+
+    void release(Chunk* c) noexcept {
+        const std::size_t len = c->len;
+        c->~Chunk();
+        upstream.deallocate(reinterpret_cast<Item*>(c), len + HEADER_ITEMS);
+    }
+};
+
+
+template<class T, std::size_t C, template<class> class UA>
+std::size_t GrowingPoolAllocator<T, C, UA>::shrink() noexcept {
+
+    for (Chunk* c = chunks; c != nullptr; c = c->next) {
+        c->freeCnt = 0U;
+    }
+
+    // With the free list in address order, the owners are found in one sweep.
+    freeList = sortByAddress(freeList);
+
+    Chunk* owner = chunksByAddr;
+    for (const FreeItem* item = freeList; item != nullptr; item = item->next) {
+        owner = ownerFrom(owner, item);
+        ++owner->freeCnt;
+    }
+
+    // Mark the chunks with all taken items freed.
+    bool any = false;
+    for (Chunk* c = chunks; c != nullptr; c = c->next) {
+        const std::size_t taken = (c == chunks) ? bumpIx : c->len;
+        if (c->freeCnt == taken) {
+            c->freeCnt = RELEASED;
+            any = true;
+        }
+    }
+
+    if (!any) {
+        return 0U;
+    }
+
+    // Unlink the items of the marked chunks from the free list.
+    FreeItem head {freeList};
+    owner = chunksByAddr;
+    for (FreeItem* prev = &head; prev->next != nullptr;) {
+        owner = ownerFrom(owner, prev->next);
+        if (owner->freeCnt == RELEASED) {
+            prev->next = prev->next->next;
+        } else {
+            prev = prev->next;
+        }
+    }
+
+    freeList = head.next;
+
+    for (Chunk** link = &chunksByAddr; *link != nullptr;) {
+        if ((*link)->freeCnt == RELEASED) {
+            *link = (*link)->nextByAddr;
+        } else {
+            link = &(*link)->nextByAddr;
+        }
+    }
+
+    std::size_t released = 0U;
+    const bool newestReleased = (chunks->freeCnt == RELEASED);
+    for (Chunk** link = &chunks; *link != nullptr;) {
+        Chunk* c = *link;
+        if (c->freeCnt == RELEASED) {
+            *link = c->next;
+            released += c->len;
+            release(c);
+        } else {
+            link = &c->next;
+        }
+    }
+
+    if (newestReleased) {
+        // Older chunks are fully taken.
+        bumpIx = (chunks != nullptr) ? chunks->len : 0U;
+    }
+
+    cap -= released;
+    return released;
+}
+
+
+template<class T, std::size_t C, template<class> class UA>
+auto GrowingPoolAllocator<T, C, UA>::sortByAddress(FreeItem* list) noexcept -> FreeItem* {
+
+    // Bottom-up merge sort, doubling the length of the sorted runs in each pass.
+    const std::less<const FreeItem*> less {};
+
+    for (std::size_t width = 1U;; width *= 2U) {
+
+        FreeItem head {nullptr};
+        FreeItem* tail = &head;
+        FreeItem* rest = list;
+        std::size_t merges = 0U;
+
+        while (rest != nullptr) {
+
+            ++merges;
+
+            FreeItem* a = rest;
+            std::size_t aLen = 0U;
+            while ((rest != nullptr) && (aLen < width)) {
+                rest = rest->next;
+                ++aLen;
+            }
+
+            FreeItem* b = rest;
+            std::size_t bLen = 0U;
+            while ((rest != nullptr) && (bLen < width)) {
+                rest = rest->next;
+                ++bLen;
+            }
+
+            while ((aLen > 0U) || (bLen > 0U)) {
+                FreeItem* taken = nullptr;
+                if ((bLen == 0U) || ((aLen > 0U) && !less(b, a))) {
+                    taken = a;
+                    a = a->next;
+                    --aLen;
+                } else {
+                    taken = b;
+                    b = b->next;
+                    --bLen;
+                }
+
+                tail->next = taken;
+                tail = taken;
+            }
+        }
+
+        tail->next = nullptr;
+        list = head.next;
+
+        if (merges <= 1U) {
+            return list;
+        }
+    }
+}
+
+
+/**
+Allocator template class with a static growing pool.
+Forwards to a static GrowingPoolAllocator, this way each instance for the same
+template arguments use a common pool.
+\tparam T Item type
+\tparam C Size of the first chunk
+\tparam L Lock type, defaults to std::mutex
+\tparam UA Upstream allocator template, defaults to std::allocator
+*/
+template<class T,
+         std::size_t C = 16U,
+         class L = std::mutex,
+         template<class> class UA = std::allocator>
+class CommonGrowingPoolAllocator : public AAllocator<T> {
+
+  public:  // types
+
+    using Allocator = ETL_NAMESPACE::GrowingPoolAllocator<T, C, UA>;
+    using ItemType = typename Allocator::ItemType;
+    using PtrType = typename Allocator::PtrType;
+    using Lock = L;
+
+    static constexpr bool uniqueAllocator = false;
+
+  public:  // functions
+
+    CommonGrowingPoolAllocator() noexcept {
+        (void)handle();  // The pool has to outlive the containers using it.
+    }
+
+    std::size_t max_size() const noexcept override {
+        return allocator().max_size();
+    }
+
+    std::size_t size() const noexcept override {
+        auto lg = Detail::lock(lock());
+        return allocator().size();
+    }
+
+    std::size_t reserve() const noexcept override {
+        auto lg = Detail::lock(lock());
+        return allocator().reserve();
+    }
+
+    PtrType allocate(std::size_t n) override {
+        auto lg = Detail::lock(lock());
+        return allocator().allocate(n);
+    }
+
+    void deallocate(PtrType ptr, std::size_t n) noexcept override {
+        auto lg = Detail::lock(lock());
+        allocator().deallocate(ptr, n);
+    }
+
+    std::size_t allocate_bulk(std::size_t n, PtrType* out) override {
+        auto lg = Detail::lock(lock());
+        return allocator().allocate_bulk(n, out);
+    }
+
+    void deallocate_bulk(PtrType* ptrs, std::size_t n) noexcept override {
+        auto lg = Detail::lock(lock());
+        allocator().deallocate_bulk(ptrs, n);
+    }
+
+    const void* handle() const noexcept override {
+        return allocator().handle();
+    }
+
+    static std::size_t capacity() noexcept {
+        auto lg = Detail::lock(lock());
+        return allocator().capacity();
+    }
+
+    /// \see GrowingPoolAllocator::shrink()
+    static std::size_t shrink() noexcept {
+        auto lg = Detail::lock(lock());
+        return allocator().shrink();
+    }
+
+  private:
+
+    static Allocator& allocator() {
+        static Allocator alloc;
+        return alloc;
+    }
+
+    static Lock& lock() {
+        static Lock l;
+        return l;
+    }
+};
+
+
+/// Helper to pass CommonGrowingPoolAllocator as single-parameter allocator template.
+template<std::size_t C = 16U, class L = std::mutex, template<class> class UA = std::allocator>
+class GrowingPoolHelper {
+
+  public:  // types
+
+    template<class T>
+    class Allocator : public CommonGrowingPoolAllocator<T, C, L, UA> {};
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_GROWINGPOOLALLOCATOR_H_
@@ -0,0 +1,400 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_INTRUSIVELIST_H_
+#define ETL_INTRUSIVELIST_H_
+
+#include <etl/base/DoubleChain.h>
+#include <etl/base/IntrusiveTools.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+namespace Intrusive {
+
+/**
+Hook to be embedded in the objects linked by Intrusive::List.
+An object may contain multiple hooks to be linked into multiple lists.
+Copying an object doesn't copy its links.
+*/
+class ListHook : private Detail::DoubleChain::Node {
+
+    template<class U, ListHook U::*K>
+    friend class List;
+
+  public:  // functions
+
+    ListHook() noexcept = default;
+
+    ListHook(const ListHook& other) noexcept :
+        Detail::DoubleChain::Node() {
+        (void)other;
+    }
+
+    ListHook& operator=(const ListHook& other) noexcept {
+        (void)other;
+        return *this;
+    }
+
+    ~ListHook() noexcept {
+        ETL_ASSERT(!isLinked());
+    }
+
+    bool isLinked() const noexcept {
+        return (next != nullptr);
+    }
+};
+
+
+/**
+Doubly linked list of objects owned by the caller.
+The list links the objects through the `ListHook` member `H`, it never
+allocates, copies or destroys the elements. The objects have to outlive
+the list or be removed before they are destroyed.
+\tparam T Element type
+\tparam H Pointer to the `ListHook` member of `T`
+*/
+template<class T, ListHook T::*H>
+class List {
+
+  public:  // types
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::uint32_t;
+
+  private:
+
+    using Chain = Detail::DoubleChain;
+    using Node = Chain::Node;
+    using Member = Detail::HookMember<T, ListHook, H>;
+
+    template<class V>
+    class Iterator {
+        friend class List;
+
+      public:  // types
+
+        using difference_type = int;
+        using value_type = typename std::remove_const<V>::type;
+        using pointer = V*;
+        using reference = V&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+      private:  // variables
+
+        Node* node;
+
+      public:  // functions
+
+        Iterator() noexcept :
+            node(nullptr) {}
+
+        template<class U, enable_if_t<is_same<const U, V>::value, bool> = true>
+        Iterator(const Iterator<U>& other) noexcept :
+            node(other.node) {}
+
+        reference operator*() const noexcept {
+            return List::ownerOf(node);
+        }
+
+        pointer operator->() const noexcept {
+            return &List::ownerOf(node);
+        }
+
+        template<class U>
+        bool operator==(const Iterator<U>& other) const noexcept {
+            return (node == other.node);
+        }
+
+        template<class U>
+        bool operator!=(const Iterator<U>& other) const noexcept {
+            return !(operator==(other));
+        }
+
+        Iterator& operator++() noexcept {
+            node = node->next;
+            return *this;
+        }
+
+        Iterator& operator--() noexcept {
+            node = node->prev;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            operator++();
+            return old;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator old = *this;
+            operator--();
+            return old;
+        }
+
+      private:
+
+        explicit Iterator(Node* n) noexcept :
+            node(n) {}
+
+        template<class U>
+        friend class Iterator;
+    };
+
+  public:
+
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  private:  // variables
+
+    Chain chain;
+    size_type size_ {0U};
+
+  public:  // functions
+
+    List() noexcept = default;
+
+    List(const List& other) = delete;
+    List& operator=(const List& other) = delete;
+
+    List(List&& other) noexcept :
+        chain(std::move(other.chain)),
+        size_(other.size_) {
+        other.size_ = 0U;
+    }
+
+    List& operator=(List&& other) noexcept {
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    ~List() noexcept {
+        clear();
+    }
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return chain.isEmpty();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+    /// \}
+
+    /// \name Element access
+    /// \{
+    reference front() noexcept {
+        ETL_ASSERT(!empty());
+        return ownerOf(chain.getFirst());
+    }
+
+    const_reference front() const noexcept {
+        ETL_ASSERT(!empty());
+        return ownerOf(chain.getFirst());
+    }
+
+    reference back() noexcept {
+        ETL_ASSERT(!empty());
+        return ownerOf(chain.getLast());
+    }
+
+    const_reference back() const noexcept {
+        ETL_ASSERT(!empty());
+        return ownerOf(chain.getLast());
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return iterator(chain.getFirst());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(chain.getFirst());
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(chain.getLast()->next);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(chain.getLast()->next);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /// Returns an iterator to a linked `item`.
+    static iterator iterator_to(T& item) noexcept {
+        ETL_ASSERT(Member::hookOf(item).isLinked());
+        return iterator(nodeOf(item));
+    }
+
+    static const_iterator iterator_to(const T& item) noexcept {
+        ETL_ASSERT((item.*H).isLinked());
+        return const_iterator(nodeOf(item));
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    void push_front(T& item) noexcept {
+        insert(begin(), item);
+    }
+
+    void push_back(T& item) noexcept {
+        insert(end(), item);
+    }
+
+    void pop_front() noexcept {
+        erase(begin());
+    }
+
+    void pop_back() noexcept {
+        erase(iterator(chain.getLast()));
+    }
+
+    /// Links `item` before `pos`. The item shall not be linked by this hook.
+    iterator insert(const_iterator pos, T& item) noexcept {
+        Node* node = nodeOf(item);
+        ETL_ASSERT(!Member::hookOf(item).isLinked());
+        chain.insertBefore(pos.node, node);
+        ++size_;
+        return iterator(node);
+    }
+
+    /// Unlinks the element at `pos`, the object itself is left intact.
+    iterator erase(const_iterator pos) noexcept {
+        ETL_ASSERT(!empty());
+        ETL_ASSERT(pos != end());
+        Node* next = pos.node->next;
+        chain.remove(pos.node);
+        --size_;
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while (first != last) {
+            first = erase(first);
+        }
+
+        return iterator(last.node);
+    }
+
+    /// Unlinks all elements, the objects are left intact.
+    void clear() noexcept {
+        Node* node = chain.detach();
+        while (node != nullptr) {
+            Node* next = node->next;
+            node->prev = nullptr;
+            node->next = nullptr;
+            node = next;
+        }
+
+        size_ = 0U;
+    }
+
+    /// Relinks all elements of `other` before `pos`, in constant time.
+    void splice(const_iterator pos, List& other) noexcept {
+        if ((&other != this) && !other.empty()) {
+            chain.splice(pos.node, other.chain.getFirst(), other.chain.getLast()->next);
+            size_ += other.size_;
+            other.size_ = 0U;
+        }
+    }
+
+    /// Relinks the element at `it` of `other` before `pos`.
+    void splice(const_iterator pos, List& other, const_iterator it) noexcept {
+        ETL_ASSERT(it != other.end());
+        if ((pos != it) && (pos.node != it.node->next)) {
+            chain.splice(pos.node, it.node, it.node->next);
+            ++size_;
+            --other.size_;
+        }
+    }
+
+    void swap(List& other) noexcept {
+        if (&other != this) {
+            chain.swap(other.chain);
+            std::swap(size_, other.size_);
+        }
+    }
+    /// \}
+
+  private:
+
+    static Node* nodeOf(const T& item) noexcept {
+        return const_cast<ListHook*>(&(item.*H));
+    }
+
+    static T& ownerOf(Node* node) noexcept {
+        return Member::ownerOf(*static_cast<ListHook*>(node));
+    }
+};
+
+
+template<class T, ListHook T::*H>
+void swap(List<T, H>& lhs, List<T, H>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace Intrusive
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_INTRUSIVELIST_H_
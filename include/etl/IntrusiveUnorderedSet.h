@@ -0,0 +1,388 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_INTRUSIVEUNORDEREDSET_H_
+#define ETL_INTRUSIVEUNORDEREDSET_H_
+
+#include <etl/base/AHashTable.h>
+#include <etl/base/IntrusiveTools.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+namespace Intrusive {
+
+/**
+Hook to be embedded in the objects linked by Intrusive::UnorderedSet.
+An object may contain multiple hooks to be linked into multiple tables.
+Copying an object doesn't copy its links.
+*/
+class UnorderedSetHook {
+
+    template<class U, UnorderedSetHook U::*K, class KF, class HS, class KE>
+    friend class UnorderedSet;
+
+    class Link : public Detail::AHashTable::Node {
+
+      public:
+
+        Link() noexcept = default;
+    };
+
+    // The node is kept in raw storage to keep the hook standard layout
+    typename std::aligned_storage<sizeof(Link), alignof(Link)>::type storage;
+
+    // The last node of a chain has no next node, so linking is tracked separately
+    bool linked;
+
+  public:  // functions
+
+    UnorderedSetHook() noexcept :
+        linked {false} {
+        new (&storage) Link();
+    }
+
+    UnorderedSetHook(const UnorderedSetHook& other) noexcept :
+        linked {false} {
+        (void)other;
+        new (&storage) Link();
+    }
+
+    UnorderedSetHook& operator=(const UnorderedSetHook& other) noexcept {
+        (void)other;
+        return *this;
+    }
+
+    ~UnorderedSetHook() noexcept {
+        ETL_ASSERT(!isLinked());
+    }
+
+    bool isLinked() const noexcept {
+        return linked;
+    }
+
+  private:
+
+    Detail::AHashTable::Node* node() noexcept {
+        return reinterpret_cast<Link*>(&storage);
+    }
+
+    static UnorderedSetHook* hookOf(Detail::AHashTable::Node* n) noexcept {
+        return reinterpret_cast<UnorderedSetHook*>(static_cast<Link*>(n));
+    }
+};
+
+
+/**
+Hash table of unique keys over objects owned by the caller.
+The table links the objects through the `UnorderedSetHook` member `H`, it never
+allocates, copies or destroys the elements. The bucket array is provided by the
+caller as well, the table doesn't rehash by itself.
+\tparam T Element type
+\tparam H Pointer to the `UnorderedSetHook` member of `T`
+\tparam KF Key function type, returning the key of an element
+\tparam HS Hash type for the key
+\tparam KE 'key equal' type
+\note The key of a linked element shall not be modified.
+*/
+template<class T,
+         UnorderedSetHook T::*H,
+         class KF,
+         class HS = std::hash<Detail::KeyOf<T, KF>>,
+         class KE = std::equal_to<Detail::KeyOf<T, KF>>>
+class UnorderedSet {
+
+  public:  // types
+
+    using value_type = T;
+    using key_type = Detail::KeyOf<T, KF>;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using hasher = HS;
+    using key_equal = KE;
+
+    using HashTable = Detail::AHashTable;
+    using size_type = HashTable::size_type;
+    using BucketItem = HashTable::BucketItem;
+    using Buckets = HashTable::Buckets;
+
+  private:
+
+    using Node = HashTable::Node;
+    using Member = Detail::HookMember<T, UnorderedSetHook, H>;
+
+    template<class V>
+    class Iterator : public HashTable::Iterator {
+        friend class UnorderedSet;
+
+      public:  // types
+
+        using difference_type = int;
+        using value_type = typename std::remove_const<V>::type;
+        using pointer = V*;
+        using reference = V&;
+        using iterator_category = std::forward_iterator_tag;
+
+      public:  // functions
+
+        Iterator() noexcept :
+            HashTable::Iterator(nullptr) {}
+
+        template<class U, enable_if_t<is_same<const U, V>::value, bool> = true>
+        Iterator(const Iterator<U>& other) noexcept :
+            HashTable::Iterator(other) {}
+
+        reference operator*() const noexcept {
+            return UnorderedSet::ownerOf(this->node());
+        }
+
+        pointer operator->() const noexcept {
+            return &UnorderedSet::ownerOf(this->node());
+        }
+
+        Iterator& operator++() noexcept {
+            HashTable::Iterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            operator++();
+            return old;
+        }
+
+      private:
+
+        explicit Iterator(Node* n) noexcept :
+            HashTable::Iterator(n) {}
+
+        explicit Iterator(const HashTable::Iterator& it) noexcept :
+            HashTable::Iterator(it) {}
+    };
+
+  public:
+
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+  private:  // variables
+
+    HashTable hashTable;
+    KF keyFn;
+    HS hashFn;
+    KE keyEq;
+
+  public:  // functions
+
+    /// Creates an empty table using the caller-owned bucket array `b`.
+    explicit UnorderedSet(Buckets b, KF kf = KF(), HS hs = HS(), KE ke = KE()) :
+        hashTable(resetBuckets(b)),
+        keyFn(std::move(kf)),
+        hashFn(std::move(hs)),
+        keyEq(std::move(ke)) {}
+
+    UnorderedSet(const UnorderedSet& other) = delete;
+    UnorderedSet& operator=(const UnorderedSet& other) = delete;
+    UnorderedSet(UnorderedSet&& other) = delete;
+    UnorderedSet& operator=(UnorderedSet&& other) = delete;
+
+    ~UnorderedSet() noexcept {
+        clear();
+    }
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return hashTable.empty();
+    }
+
+    size_type size() const noexcept {
+        return hashTable.size();
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return iterator(hashTable.begin());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(hashTable.begin());
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(hashTable.end());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(hashTable.end());
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    /// Returns an iterator to a linked `item`.
+    static iterator iterator_to(T& item) noexcept {
+        ETL_ASSERT((item.*H).isLinked());
+        return iterator(nodeOf(item));
+    }
+
+    static const_iterator iterator_to(const T& item) noexcept {
+        ETL_ASSERT((item.*H).isLinked());
+        return const_iterator(nodeOf(item));
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    /// Links `item` unless an element with equal key is already linked.
+    /// The item shall not be linked by this hook.
+    std::pair<iterator, bool> insert(T& item) {
+        ETL_ASSERT(!(item.*H).isLinked());
+
+        const key_type& key = keyFn(item);
+        const auto h = hashFn(key);
+
+        auto it = findWithHash(key, h);
+        if (it != end()) {
+            return std::make_pair(it, false);
+        }
+
+        Node* node = nodeOf(item);
+        node->hash = h;
+        hashTable.insert(*node);
+        (item.*H).linked = true;
+        return std::make_pair(iterator(node), true);
+    }
+
+    /// Unlinks the element at `pos`, the object itself is left intact.
+    iterator erase(const_iterator pos) noexcept {
+        ETL_ASSERT(pos != end());
+        Node* node = pos.node();
+        iterator next(static_cast<Node*>(node->next));
+        hashTable.remove(*node);
+        UnorderedSetHook::hookOf(node)->linked = false;
+        return next;
+    }
+
+    size_type erase(const key_type& key) {
+        auto it = find(key);
+        if (it != end()) {
+            erase(it);
+            return 1U;
+        }
+
+        return 0U;
+    }
+
+    /// Unlinks all elements, the objects are left intact.
+    void clear() noexcept {
+        while (!empty()) {
+            erase(begin());
+        }
+    }
+    /// \}
+
+    /// \name Lookup
+    /// \{
+    iterator find(const key_type& key) {
+        return findWithHash(key, hashFn(key));
+    }
+
+    const_iterator find(const key_type& key) const {
+        return const_cast<UnorderedSet*>(this)->find(key);
+    }
+
+    size_type count(const key_type& key) const {
+        return (find(key) != end()) ? 1U : 0U;
+    }
+    /// \}
+
+    /// \name Bucket interface
+    /// \{
+    size_type bucket_count() const noexcept {
+        return hashTable.divisorForHash();
+    }
+
+    size_type bucket(const key_type& key) const {
+        return hashTable.bucketIxOfHash(hashFn(key));
+    }
+
+    float load_factor() const noexcept {
+        return static_cast<float>(size()) / bucket_count();
+    }
+
+    /// Relinks all elements to the new caller-owned bucket array `b`.
+    /// The previous bucket array is released.
+    void rehash(Buckets b) {
+        hashTable = Detail::rehashTable(hashTable, resetBuckets(b));
+    }
+    /// \}
+
+  private:
+
+    iterator findWithHash(const key_type& key, typename HashTable::HashType h) {
+        auto range = hashTable.equalHashRange(h);
+        Node* node = range.first;
+        while ((node != range.second) && !keyEq(keyFn(ownerOf(node)), key)) {
+            node = static_cast<Node*>(node->next);
+        }
+
+        return (node != range.second) ? iterator(node) : end();
+    }
+
+    static Buckets resetBuckets(Buckets b) noexcept {
+        ETL_ASSERT(!b.empty());
+        for (auto& item : b) {
+            item = nullptr;
+        }
+
+        return b;
+    }
+
+    static Node* nodeOf(const T& item) noexcept {
+        return const_cast<UnorderedSetHook&>(item.*H).node();
+    }
+
+    static T& ownerOf(Node* node) noexcept {
+        return Member::ownerOf(*UnorderedSetHook::hookOf(node));
+    }
+};
+
+}  // namespace Intrusive
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_INTRUSIVEUNORDEREDSET_H_
@@ -22,6 +22,7 @@ limitations under the License.
 #ifndef ETL_LIST_H_
 #define ETL_LIST_H_
 
+#include <etl/MonotonicArena.h>
 #include <etl/PoolAllocator.h>
 #include <etl/base/AAllocator.h>
 #include <etl/base/ListTemplate.h>
@@ -241,6 +242,17 @@ class List : public ETL_NAMESPACE::List<T> {
         this->clear();
     }
 
+    /// Destroys all elements. Trivially destructible elements are released
+    /// at once by resetting the own pool.
+    void clear() noexcept(noexcept(std::declval<Base>().clear())) {
+        if (std::is_trivially_destructible<typename Base::value_type>::value) {
+            this->dropNodes();
+            allocator.reset();
+        } else {
+            Base::clear();
+        }
+    }
+
     Allocator& getAllocator() const {
         return allocator;
     }
@@ -383,6 +395,116 @@ class List : public ETL_NAMESPACE::List<T> {
 };
 
 }  // namespace Pooled
+
+
+namespace Arena {
+
+/// List allocating from a MonotonicArena, erased nodes are not released to the arena.
+template<class T>
+class List : public ETL_NAMESPACE::List<T> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::List<T>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+
+    using Allocator = ArenaAllocator<typename Base::Node>;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    explicit List(MonotonicArena& arena) noexcept :
+        Base {allocator},
+        allocator {arena} {}
+
+    List(MonotonicArena& arena, size_type len) :
+        List {arena} {
+        this->insert(this->cbegin(), len, T {});
+    }
+
+    List(MonotonicArena& arena, size_type len, const T& item) :
+        List {arena} {
+        this->insert(this->cbegin(), len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    List(MonotonicArena& arena, InputIt first, InputIt last) :
+        List {arena} {
+        this->insert(this->cbegin(), first, last);
+    }
+
+    List(MonotonicArena& arena, std::initializer_list<T> initList) :
+        List {arena} {
+        operator=(initList);
+    }
+
+    /// Copies to the arena of `other`.
+    List(const List& other) :
+        List {other.getArena()} {
+        Base::operator=(other);
+    }
+
+    List& operator=(const List& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    List& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    /// Binds to the arena of `other`.
+    List(List&& other) noexcept :
+        List {other.getArena()} {
+        this->swap(other);
+    }
+
+    List& operator=(List&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    List& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~List() {
+        this->clear();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    MonotonicArena& getArena() const noexcept {
+        return allocator.getArena();
+    }
+
+    /// Relinks the nodes when both use the same arena, swaps the elements otherwise.
+    void swap(List& other) {
+        if (&other != this) {
+            Base::swap(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(List& lhs, List& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Arena
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_LIST_H_
@@ -22,6 +22,7 @@ limitations under the License.
 #ifndef ETL_MAP_H_
 #define ETL_MAP_H_
 
+#include <etl/MonotonicArena.h>
 #include <etl/PoolAllocator.h>
 #include <etl/base/AAllocator.h>
 #include <etl/base/MapTemplate.h>
@@ -199,6 +200,17 @@ class Map : public ETL_NAMESPACE::Map<K, E, C> {
         this->clear();
     }
 
+    /// Destroys all elements. Trivially destructible elements are released
+    /// at once by resetting the own pool.
+    void clear() noexcept(noexcept(std::declval<Base>().clear())) {
+        if (std::is_trivially_destructible<typename Base::value_type>::value) {
+            this->dropNodes();
+            allocator.reset();
+        } else {
+            Base::clear();
+        }
+    }
+
     Allocator& getAllocator() const noexcept {
         return allocator;
     }
@@ -322,6 +334,95 @@ class Map : public ETL_NAMESPACE::Map<K, E, C> {
 
 }  // namespace Pooled
 
+
+namespace Arena {
+
+/// Map allocating from a MonotonicArena, erased nodes are not released to the arena.
+template<class K, class E, class C = std::less<K>>
+class Map : public ETL_NAMESPACE::Map<K, E, C> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::Map<K, E, C>;
+    using Allocator = ArenaAllocator<typename Base::Node>;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    explicit Map(MonotonicArena& arena) noexcept :
+        Base {allocator},
+        allocator {arena} {}
+
+    Map(MonotonicArena& arena, std::initializer_list<typename Base::value_type> initList) :
+        Map {arena} {
+        operator=(initList);
+    }
+
+    /// Copies to the arena of `other`.
+    Map(const Map& other) :
+        Map {other.getArena()} {
+        Base::operator=(other);
+    }
+
+    Map& operator=(const Map& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Map& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    /// Binds to the arena of `other`.
+    Map(Map&& other) noexcept :
+        Map {other.getArena()} {
+        this->swap(other);
+    }
+
+    Map& operator=(Map&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    Map& operator=(std::initializer_list<typename Base::value_type> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~Map() noexcept(Allocator::noexceptDestroy) {
+        this->clear();
+    }
+
+    Allocator& getAllocator() const noexcept {
+        return allocator;
+    }
+
+    MonotonicArena& getArena() const noexcept {
+        return allocator.getArena();
+    }
+
+    /// Relinks the nodes when both use the same arena, swaps the elements otherwise.
+    void swap(Map& other) {
+        if (&other != this) {
+            Base::swap(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(Map& lhs, Map& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Arena
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_MAP_H_
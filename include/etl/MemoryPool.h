@@ -32,18 +32,23 @@ namespace ETL_NAMESPACE {
 Memory pool template.
 \tparam S Allocated block size
 \tparam N Pool length
+\tparam A Minimal alignment of the blocks, `uint64_t` alignment is used when smaller
 */
-template<std::size_t S, std::size_t N>
+template<std::size_t S, std::size_t N, std::size_t A = alignof(std::uint64_t)>
 class MemoryPool {
 
     static_assert(S > 0, "Invalid item size");
     static_assert(N > 0, "Invalid pool length");
+    static_assert((A > 0) && ((A & (A - 1U)) == 0U), "Invalid alignment");
 
   private:  // types
 
     using MinItemType = std::uint64_t;
 
-    union ItemAlias {
+    static constexpr std::size_t ITEM_ALIGN {(A > alignof(MinItemType)) ? A
+                                                                         : alignof(MinItemType)};
+
+    union alignas(ITEM_ALIGN) ItemAlias {
         MinItemType minItem;   // for aliasing alignment and size of Minimal Item
         std::uint8_t item[S];  // for aliasing size of S
         std::uint8_t freeItem[sizeof(
@@ -54,12 +59,13 @@ class MemoryPool {
 
   private:  // variables
 
-    Array<ItemAlias, N> data {};
+    Array<ItemAlias, N> data;  // Left uninitialized, items are taken by the lazy bump index
     Detail::PoolBase base {data};
 
   public:  // functions
 
-    MemoryPool() = default;
+    /// User-provided to avoid zero-filling the storage on value-initialization.
+    MemoryPool() noexcept {}
     MemoryPool(const MemoryPool& other) = delete;
     MemoryPool& operator=(const MemoryPool& other) = delete;
     MemoryPool(MemoryPool&& other) = delete;
@@ -74,6 +80,11 @@ class MemoryPool {
         return base.push(item);
     }
 
+    /// Releases all items at once in O(1).
+    void reset() noexcept {
+        base.reset();
+    }
+
     std::size_t getFreeCount() const noexcept {
         return base.getFreeCount();
     }
@@ -85,6 +96,14 @@ class MemoryPool {
     std::size_t getCount() const noexcept {
         return capacity() - getFreeCount();
     }
+
+    PoolStats getStats() const noexcept {
+        return base.getStats();
+    }
+
+    static constexpr std::size_t alignment() noexcept {
+        return alignof(ItemAlias);
+    }
 };
 
 }  // namespace ETL_NAMESPACE
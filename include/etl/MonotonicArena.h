@@ -0,0 +1,216 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_MONOTONICARENA_H_
+#define ETL_MONOTONICARENA_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/MemStrategies.h>
+#include <etl/etlSupport.h>
+
+#include <cstddef>
+#include <limits>
+
+namespace ETL_NAMESPACE {
+
+/**
+Monotonic bump allocator over caller-provided buffers.
+Buffers are chained in the order they are added, allocation moves to the next
+buffer when the current one is exhausted. Deallocation is not supported,
+`reset()` releases all allocations at once.
+\note The buffers are owned by the caller and have to outlive the arena.
+*/
+class MonotonicArena {
+
+  private:  // types
+
+    struct Chunk {
+        Chunk* next;
+        uint8_t* end;
+    };
+
+  private:  // variables
+
+    Chunk* first {nullptr};
+    Chunk* last {nullptr};
+    Chunk* current {nullptr};
+    uint8_t* pos {nullptr};
+
+    std::size_t cap {0U};
+    std::size_t used {0U};
+    std::size_t resets {0U};
+
+  public:  // functions
+
+    MonotonicArena() noexcept = default;
+
+    MonotonicArena(void* buffer, std::size_t size) noexcept {
+        addBuffer(buffer, size);
+    }
+
+    MonotonicArena(const MonotonicArena& other) = delete;
+    MonotonicArena& operator=(const MonotonicArena& other) = delete;
+    MonotonicArena(MonotonicArena&& other) = delete;
+    MonotonicArena& operator=(MonotonicArena&& other) = delete;
+
+    /// Appends a buffer to the arena.
+    /// \return false if the buffer is too small to be used.
+    bool addBuffer(void* buffer, std::size_t size) noexcept;
+
+    /// Returns `nullptr` when the arena is exhausted.
+    /// \param align has to be a power of two.
+    void* allocate(std::size_t size, std::size_t align) noexcept;
+
+    /// Releases all allocations in O(1), the buffers are kept.
+    void reset() noexcept;
+
+    /// Total size of the buffers, without the chunk headers.
+    std::size_t capacity() const noexcept {
+        return cap;
+    }
+
+    /// Bytes allocated since the last reset, including alignment padding.
+    std::size_t getUsed() const noexcept {
+        return used;
+    }
+
+    /// Bytes available in the current and the following buffers.
+    std::size_t available() const noexcept;
+
+    /// Number of `reset()` calls, identifies the current allocation epoch.
+    std::size_t getResetCount() const noexcept {
+        return resets;
+    }
+
+  private:
+
+    static uint8_t* dataOf(Chunk* c) noexcept {
+        return reinterpret_cast<uint8_t*>(c + 1);
+    }
+};
+
+
+/**
+MonotonicArena with a buffer of `N` bytes as a member.
+\tparam N Size of the buffer
+*/
+template<std::size_t N>
+class StaticArena : public MonotonicArena {
+
+  private:  // variables
+
+    alignas(std::max_align_t) uint8_t buffer[N];
+
+  public:  // functions
+
+    StaticArena() noexcept {
+        addBuffer(buffer, N);
+    }
+};
+
+
+/**
+Allocator template class bound to a MonotonicArena.
+Implements AAllocator for any `n`, deallocation is a no-op.
+\tparam T Item type
+*/
+template<class T>
+class ArenaAllocator : public AAllocator<T> {
+
+  public:  // types
+
+    using ItemType = T;
+    using PtrType = T*;
+
+    static constexpr bool uniqueAllocator = false;
+
+  private:  // variables
+
+    MonotonicArena* arena;
+    std::size_t cnt {0U};
+    std::size_t epoch;
+
+  public:  // functions
+
+    explicit ArenaAllocator(MonotonicArena& a) noexcept :
+        arena {&a},
+        epoch {a.getResetCount()} {}
+
+    std::size_t max_size() const noexcept override {
+        return arena->capacity() / sizeof(T);
+    }
+
+    /// Returns the number of items handed out by this allocator since the last reset of the arena.
+    std::size_t size() const noexcept override {
+        return (epoch == arena->getResetCount()) ? cnt : 0U;
+    }
+
+    std::size_t reserve() const noexcept override {
+        return arena->available() / sizeof(T);
+    }
+
+    PtrType allocate(std::size_t n) override {
+        if (n > (std::numeric_limits<std::size_t>::max() / sizeof(T))) {
+            return nullptr;
+        }
+
+        PtrType ptr = static_cast<PtrType>(arena->allocate(n * sizeof(T), alignof(T)));
+        if (ptr != nullptr) {
+            if (epoch != arena->getResetCount()) {
+                epoch = arena->getResetCount();
+                cnt = 0U;
+            }
+            cnt += n;
+        }
+
+        return ptr;
+    }
+
+    void deallocate(PtrType ptr, std::size_t n) noexcept override {
+        (void)ptr;
+        (void)n;
+    }
+
+    const void* handle() const noexcept override {
+        return arena;
+    }
+
+    MonotonicArena& getArena() const noexcept {
+        return *arena;
+    }
+};
+
+
+/// Vectors on the same arena can swap their storage.
+template<class T>
+struct DynamicStrategyTraits<ArenaAllocator<T>> {
+
+    static constexpr bool uniqueAllocator = false;
+
+    static const void* handleOf(const ArenaAllocator<T>& a) noexcept {
+        return a.handle();
+    }
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_MONOTONICARENA_H_
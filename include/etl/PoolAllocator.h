@@ -22,27 +22,97 @@ limitations under the License.
 #ifndef ETL_POOLALLOCATOR_H_
 #define ETL_POOLALLOCATOR_H_
 
+#include <etl/AtomicMemoryPool.h>
+#include <etl/BitmapMemoryPool.h>
 #include <etl/MemoryPool.h>
+#include <etl/PoolRegistry.h>
 #include <etl/base/AAllocator.h>
 #include <etl/base/tools.h>
 #include <etl/etlSupport.h>
 
+#include <atomic>
 #include <mutex>
+#include <type_traits>
 
 namespace ETL_NAMESPACE {
 
+/// Lock type tag for pool allocators to use AtomicMemoryPool without locking.
+struct LockFree {};
+
+/// Lock type tag for pool allocators to use BitmapMemoryPool with lock `L`.
+template<class L = Detail::NullLock>
+struct AddressOrdered {};
+
+namespace Detail {
+
+template<std::size_t S, std::size_t N, std::size_t A, class L>
+struct PoolSelector {
+    using Pool = MemoryPool<S, N, A>;
+    using Lock = L;
+};
+
+template<std::size_t S, std::size_t N, std::size_t A>
+struct PoolSelector<S, N, A, LockFree> {
+    using Pool = AtomicMemoryPool<S, N, A>;
+    using Lock = NullLock;
+};
+
+template<std::size_t S, std::size_t N, std::size_t A, class L>
+struct PoolSelector<S, N, A, AddressOrdered<L>> {
+    using Pool = BitmapMemoryPool<S, N, A>;
+    using Lock = L;
+};
+
+
+/// Pools serving contiguous runs of items.
+template<class P>
+struct HasRuns : std::false_type {};
+
+template<std::size_t S, std::size_t N, std::size_t A>
+struct HasRuns<BitmapMemoryPool<S, N, A>> : std::true_type {};
+
+
+template<class P>
+void* popRun(P& pool, std::size_t n) noexcept {
+    return (n == 1U) ? pool.pop() : nullptr;
+}
+
+template<std::size_t S, std::size_t N, std::size_t A>
+void* popRun(BitmapMemoryPool<S, N, A>& pool, std::size_t n) noexcept {
+    return pool.pop(n);
+}
+
+template<class P>
+void pushRun(P& pool, void* ptr, std::size_t n) noexcept {
+    (void)n;
+    pool.push(ptr);
+}
+
+template<std::size_t S, std::size_t N, std::size_t A>
+void pushRun(BitmapMemoryPool<S, N, A>& pool, void* ptr, std::size_t n) noexcept {
+    pool.push(ptr, n);
+}
+
+}  // namespace Detail
+
+
 /**
 Allocator template class.
 Implements AAllocator based on MemoryPool.
-\note This allocator supports allocating exactly _one element_ for one call.
+\note This allocator supports allocating exactly _one element_ for one call of `allocate()`,
+use `allocate_bulk()` to get multiple elements for one lock. With `AddressOrdered`
+contiguous elements can be allocated as well.
 \tparam T Item type
 \tparam N Size of pool
-\tparam L Lock type, defaults to 'null lock'
+\tparam L Lock type, defaults to 'null lock', `LockFree` selects AtomicMemoryPool,
+`AddressOrdered` selects BitmapMemoryPool
+\tparam A Alignment of the items, defaults to the alignment of `T`
 */
-template<class T, uint32_t N, class L = Detail::NullLock>
+template<class T, uint32_t N, class L = Detail::NullLock, std::size_t A = alignof(T)>
 class PoolAllocator : public AAllocator<T> {
 
     static_assert(N > 0, "Invalid pool size");
+    static_assert(A >= alignof(T), "Alignment weaker than required by T");
 
   public:  // types
 
@@ -54,45 +124,104 @@ class PoolAllocator : public AAllocator<T> {
 
   private:  // variables
 
-    MemoryPool<sizeof(T), N> pool {};
-    mutable Lock l {};
+    using Selector = Detail::PoolSelector<sizeof(T), N, A, L>;
+
+    typename Selector::Pool pool {};
+    mutable typename Selector::Lock l {};
+
+#if ETL_POOL_STATS
+    mutable std::size_t contentions {0U};
+    std::size_t unsupported {0U};
+#endif
 
   public:  // functions
 
     std::size_t max_size() const noexcept override {
-        auto lg = Detail::lock(l);
+        auto lg = guard();
         return pool.capacity();
     }
 
     std::size_t size() const noexcept override {
-        auto lg = Detail::lock(l);
+        auto lg = guard();
         return pool.getCount();
     }
 
     std::size_t reserve() const noexcept override {
-        auto lg = Detail::lock(l);
+        auto lg = guard();
         ETL_ASSERT(pool.capacity() >= pool.getCount());
         return pool.capacity() - pool.getCount();
     }
 
     PtrType allocate(std::size_t n) override {
-        auto lg = Detail::lock(l);
-        if (n == 1) {
-            return static_cast<PtrType>(pool.pop());
-        } else {
-            return nullptr;
+        auto lg = guard();
+        void* ptr = Detail::popRun(pool, n);
+#if ETL_POOL_STATS
+        if ((n != 1U) && !Detail::HasRuns<typename Selector::Pool>::value) {
+            ++unsupported;
         }
+#endif
+        return static_cast<PtrType>(ptr);
     }
 
     void deallocate(PtrType ptr, std::size_t n) noexcept override {
-        auto lg = Detail::lock(l);
-        (void)n;
-        pool.push(ptr);
+        auto lg = guard();
+        Detail::pushRun(pool, ptr, n);
+    }
+
+    /// Allocates up to `n` single items taking the lock once.
+    std::size_t allocate_bulk(std::size_t n, PtrType* out) override {
+        auto lg = guard();
+        std::size_t cnt = 0U;
+        while (cnt < n) {
+            void* ptr = pool.pop();
+            if (ptr == nullptr) {
+                break;
+            }
+            out[cnt] = static_cast<PtrType>(ptr);
+            ++cnt;
+        }
+        return cnt;
+    }
+
+    /// Deallocates `n` single items taking the lock once.
+    void deallocate_bulk(PtrType* ptrs, std::size_t n) noexcept override {
+        auto lg = guard();
+        for (std::size_t i = 0U; i < n; ++i) {
+            pool.push(ptrs[i]);
+        }
     }
 
     const void* handle() const noexcept override {
         return &pool;
     }
+
+    /// Releases all items of the pool at once.
+    /// \note The items shall be already destroyed, or trivially destructible.
+    void reset() noexcept {
+        auto lg = guard();
+        pool.reset();
+    }
+
+    /// Returns the usage counters, all zero unless `ETL_POOL_STATS` is enabled.
+    PoolStats getStats() const noexcept {
+        auto lg = guard();
+        PoolStats stats = pool.getStats();
+#if ETL_POOL_STATS
+        stats.failures += unsupported;
+        stats.contentions = contentions;
+#endif
+        return stats;
+    }
+
+  private:
+
+    Detail::LockGuard<typename Selector::Lock> guard() const {
+#if ETL_POOL_STATS
+        return Detail::lockCounted(l, contentions);
+#else
+        return Detail::lock(l);
+#endif
+    }
 };
 
 
@@ -104,16 +233,18 @@ a common pool.
 \note This allocator supports allocating exactly _one element_ for one call.
 \tparam T Item type
 \tparam N Size of pool
-\tparam L Lock type, defaults to std::mutex
+\tparam L Lock type, defaults to std::mutex, `LockFree` selects AtomicMemoryPool,
+`AddressOrdered` selects BitmapMemoryPool
+\tparam A Alignment of the items, defaults to the alignment of `T`
 */
-template<class T, uint32_t N, class L = std::mutex>
+template<class T, uint32_t N, class L = std::mutex, std::size_t A = alignof(T)>
 class CommonPoolAllocator : public AAllocator<T> {
 
     static_assert(N > 0, "Invalid pool size");
 
   public:  // types
 
-    using Allocator = ETL_NAMESPACE::PoolAllocator<T, N, L>;
+    using Allocator = ETL_NAMESPACE::PoolAllocator<T, N, L, A>;
     using ItemType = typename Allocator::ItemType;
     using PtrType = typename Allocator::PtrType;
     using Lock = L;
@@ -142,20 +273,236 @@ class CommonPoolAllocator : public AAllocator<T> {
         allocator().deallocate(ptr, n);
     }
 
+    std::size_t allocate_bulk(std::size_t n, PtrType* out) override {
+        return allocator().allocate_bulk(n, out);
+    }
+
+    void deallocate_bulk(PtrType* ptrs, std::size_t n) noexcept override {
+        allocator().deallocate_bulk(ptrs, n);
+    }
+
     const void* handle() const noexcept override {
         return allocator().handle();
     }
 
+    /// \see PoolAllocator::getStats()
+    static PoolStats getStats() noexcept {
+        return allocator().getStats();
+    }
+
   private:
 
+    struct Instance {
+
+        Allocator alloc {};
+        PoolRegistry::Entry entry;
+
+        Instance() noexcept :
+            entry {ETL_POOL_SIGNATURE, sizeof(T), N, &count, &getStats, nullptr} {
+            PoolRegistry::add(entry);
+        }
+    };
+
     static Allocator& allocator() {
-        static Allocator alloc;
-        return alloc;
+        static Instance inst;
+        return inst.alloc;
+    }
+
+    static std::size_t count() {
+        return allocator().size();
+    }
+};
+
+
+/**
+Allocator template class with static pool and thread-local caches.
+Like CommonPoolAllocator, but each thread keeps a _magazine_ of up to `M` free items.
+Allocations and deallocations are served from the magazine without locking,
+it's refilled from and flushed to the common pool in batches of `M / 2`.
+Cached items are returned to the common pool on thread exit or on `flush()`.
+\note At most `M` items per thread are held back from the other threads.
+\tparam T Item type
+\tparam N Size of pool
+\tparam M Size of the thread-local cache
+\tparam L Lock type of the common pool, defaults to std::mutex
+\tparam A Alignment of the items, defaults to the alignment of `T`
+*/
+template<class T, uint32_t N, std::size_t M, class L = std::mutex, std::size_t A = alignof(T)>
+class CachedPoolAllocator : public AAllocator<T> {
+
+    static_assert(N > 0, "Invalid pool size");
+    static_assert(M >= 2U, "Invalid cache size");
+
+  public:  // types
+
+    using Allocator = ETL_NAMESPACE::PoolAllocator<T, N, L, A>;
+    using ItemType = typename Allocator::ItemType;
+    using PtrType = typename Allocator::PtrType;
+    using Lock = L;
+
+    static constexpr bool uniqueAllocator = false;
+
+  private:  // types
+
+    static constexpr std::size_t BATCH {M / 2U};
+
+    struct Magazine {
+
+        PtrType items[M];
+        std::size_t cnt {0U};
+
+        Magazine() {
+            (void)shared();  // The common pool has to outlive the magazines.
+        }
+
+        ~Magazine() {
+            flush();
+        }
+
+        void flush() noexcept {
+            shared().deallocate_bulk(items, cnt);
+            cachedCnt().fetch_sub(cnt, std::memory_order_relaxed);
+            cnt = 0U;
+        }
+
+        bool refill() {
+            const std::size_t got = shared().allocate_bulk(BATCH, items + cnt);
+            cnt += got;
+            cachedCnt().fetch_add(got, std::memory_order_relaxed);
+            return got > 0U;
+        }
+
+        void spill() noexcept {
+            cnt -= BATCH;
+            shared().deallocate_bulk(items + cnt, BATCH);
+            cachedCnt().fetch_sub(BATCH, std::memory_order_relaxed);
+        }
+    };
+
+  public:  // functions
+
+    std::size_t max_size() const noexcept override {
+        return shared().max_size();
+    }
+
+    std::size_t size() const noexcept override {
+        return shared().size() - cachedCnt().load(std::memory_order_relaxed);
+    }
+
+    /// Returns the number of items available for the calling thread.
+    std::size_t reserve() const noexcept override {
+        return shared().reserve() + magazine().cnt;
+    }
+
+    PtrType allocate(std::size_t n) override {
+        if (n != 1U) {
+            return nullptr;
+        }
+
+        Magazine& mag = magazine();
+        if ((mag.cnt == 0U) && !mag.refill()) {
+            return nullptr;
+        }
+
+        --mag.cnt;
+        cachedCnt().fetch_sub(1U, std::memory_order_relaxed);
+        return mag.items[mag.cnt];
+    }
+
+    void deallocate(PtrType ptr, std::size_t n) noexcept override {
+        (void)n;
+        Magazine& mag = magazine();
+        if (mag.cnt == M) {
+            mag.spill();
+        }
+
+        mag.items[mag.cnt] = ptr;
+        ++mag.cnt;
+        cachedCnt().fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    std::size_t allocate_bulk(std::size_t n, PtrType* out) override {
+        Magazine& mag = magazine();
+        const std::size_t fromCache = (n < mag.cnt) ? n : mag.cnt;
+        for (std::size_t i = 0U; i < fromCache; ++i) {
+            --mag.cnt;
+            out[i] = mag.items[mag.cnt];
+        }
+
+        cachedCnt().fetch_sub(fromCache, std::memory_order_relaxed);
+        return fromCache + shared().allocate_bulk(n - fromCache, out + fromCache);
+    }
+
+    void deallocate_bulk(PtrType* ptrs, std::size_t n) noexcept override {
+        Magazine& mag = magazine();
+        const std::size_t toCache = ((M - mag.cnt) < n) ? (M - mag.cnt) : n;
+        for (std::size_t i = 0U; i < toCache; ++i) {
+            mag.items[mag.cnt] = ptrs[i];
+            ++mag.cnt;
+        }
+
+        cachedCnt().fetch_add(toCache, std::memory_order_relaxed);
+        shared().deallocate_bulk(ptrs + toCache, n - toCache);
+    }
+
+    const void* handle() const noexcept override {
+        return shared().handle();
+    }
+
+    /// \see PoolAllocator::getStats()
+    /// \note Allocations served by the thread-local caches are not counted.
+    static PoolStats getStats() noexcept {
+        return shared().getStats();
+    }
+
+    /// Returns the items cached by the calling thread to the common pool.
+    static void flush() noexcept {
+        magazine().flush();
+    }
+
+  private:
+
+    struct Instance {
+
+        Allocator alloc {};
+        PoolRegistry::Entry entry;
+
+        Instance() noexcept :
+            entry {ETL_POOL_SIGNATURE, sizeof(T), N, &count, &getStats, nullptr} {
+            PoolRegistry::add(entry);
+        }
+    };
+
+    static Allocator& shared() {
+        static Instance inst;
+        return inst.alloc;
+    }
+
+    static std::size_t count() {
+        return shared().size() - cachedCnt().load(std::memory_order_relaxed);
+    }
+
+    static std::atomic<std::size_t>& cachedCnt() {
+        static std::atomic<std::size_t> cnt {0U};
+        return cnt;
+    }
+
+    static Magazine& magazine() {
+        thread_local Magazine mag;
+        return mag;
     }
 };
 
+template<class T, uint32_t N, std::size_t M, class L, std::size_t A>
+constexpr std::size_t CachedPoolAllocator<T, N, M, L, A>::BATCH;
+
 
-template<uint32_t N>
+/**
+Helper to pass pool allocators of size `N` as single-parameter allocator templates.
+\tparam N Size of pool
+\tparam M Size of the thread-local cache of `CachedAllocator`
+*/
+template<uint32_t N, std::size_t M = 16U>
 class PoolHelperForSize {
 
   public:  // types
@@ -163,8 +510,16 @@ class PoolHelperForSize {
     template<class T>
     class Allocator : public PoolAllocator<T, N> {};
 
+#if ETL_POOL_THREAD_CACHE > 0
+    template<class T, class L = std::mutex>
+    class CommonAllocator : public CachedPoolAllocator<T, N, ETL_POOL_THREAD_CACHE, L> {};
+#else
     template<class T, class L = std::mutex>
     class CommonAllocator : public CommonPoolAllocator<T, N, L> {};
+#endif
+
+    template<class T>
+    class CachedAllocator : public CachedPoolAllocator<T, N, M> {};
 };
 
 }  // namespace ETL_NAMESPACE
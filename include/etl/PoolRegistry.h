@@ -0,0 +1,85 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_POOLREGISTRY_H_
+#define ETL_POOLREGISTRY_H_
+
+#include <etl/base/PoolStats.h>
+#include <etl/etlSupport.h>
+
+#include <atomic>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ETL_POOL_SIGNATURE __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define ETL_POOL_SIGNATURE __FUNCSIG__
+#else
+#define ETL_POOL_SIGNATURE ""
+#endif
+
+namespace ETL_NAMESPACE {
+
+/**
+Registry of the common pools.
+Each instantiation of the common pool allocators registers its pool at first use,
+so the pools of `Pooled` containers can be enumerated e.g. to tune their sizes.
+*/
+class PoolRegistry {
+
+  public:  // types
+
+    struct Entry {
+        /// Signature of the registering function, naming the allocator type if available.
+        const char* name;
+        std::size_t itemSize;
+        std::size_t capacity;
+        std::size_t (*size)();
+        PoolStats (*stats)();
+        Entry* next;
+    };
+
+  public:  // functions
+
+    PoolRegistry() = delete;
+
+    /// Adds an entry with static storage duration, it's safe to call concurrently.
+    static void add(Entry& entry) noexcept;
+
+    static const Entry* first() noexcept {
+        return head().load(std::memory_order_acquire);
+    }
+
+    template<class F>
+    static void forEach(F&& f) {
+        for (const Entry* e = first(); e != nullptr; e = e->next) {
+            f(*e);
+        }
+    }
+
+  private:
+
+    static std::atomic<Entry*>& head() noexcept;
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_POOLREGISTRY_H_
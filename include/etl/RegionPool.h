@@ -0,0 +1,144 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_REGIONPOOL_H_
+#define ETL_REGIONPOOL_H_
+
+#include <etl/base/OffsetPoolBase.h>
+#include <etl/base/OffsetPtr.h>
+#include <etl/etlSupport.h>
+
+#include <cstddef>
+#include <new>
+
+namespace ETL_NAMESPACE {
+
+/**
+Memory pool placed into a caller-provided memory region, e.g. shared memory.
+The pool header and the items are put into the region, all the links are stored as
+offsets, so the region can be mapped or copied to any other address and used there
+after `attach()`.
+\note The pool is not synchronized between the processes sharing the region.
+*/
+class RegionPool {
+
+  public:  // constants
+
+    static constexpr std::uint32_t MAGIC {0x45544C50U};  // 'ETLP'
+
+  private:  // variables
+
+    Detail::RegionTag tag;
+    Detail::OffsetPoolBase base;
+
+  public:  // functions
+
+    RegionPool(const RegionPool& other) = delete;
+    RegionPool& operator=(const RegionPool& other) = delete;
+    RegionPool(RegionPool&& other) = delete;
+    RegionPool& operator=(RegionPool&& other) = delete;
+    ~RegionPool() = default;
+
+    /// Creates a pool of as many items as fit into the region.
+    /// \param region start of the region, aligned to `alignof(RegionPool)`
+    /// \param size size of the region in bytes
+    /// \param itemSize size of the items
+    /// \param align alignment of the items, a power of two
+    /// \return the pool at the start of the region, `nullptr` when no item fits
+    static RegionPool* create(void* region,
+                              std::size_t size,
+                              std::size_t itemSize,
+                              std::size_t align = alignof(std::max_align_t)) noexcept {
+
+        using FreeItem = Detail::OffsetPoolBase::FreeItem;
+
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(RegionPool))
+            || (size < sizeof(RegionPool))) {
+            return nullptr;
+        }
+
+        ETL_ASSERT((align > 0U) && ((align & (align - 1U)) == 0U));
+        align = (align > alignof(FreeItem)) ? align : alignof(FreeItem);
+        itemSize = (itemSize > sizeof(FreeItem)) ? itemSize : sizeof(FreeItem);
+        itemSize = ((itemSize + align - 1U) / align) * align;
+
+        auto* const start = static_cast<std::uint8_t*>(region);
+        auto* const items = static_cast<std::uint8_t*>(
+            Detail::alignUp(start + sizeof(RegionPool), align));
+        const std::size_t used = static_cast<std::size_t>(items - start);
+        const std::size_t n = (used < size) ? ((size - used) / itemSize) : 0U;
+
+        if (n == 0U) {
+            return nullptr;
+        }
+
+        return new (region) RegionPool {items, itemSize, n};
+    }
+
+    /// Returns the pool created in the region, `nullptr` when the region holds no pool.
+    static RegionPool* attach(void* region) noexcept {
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(RegionPool))) {
+            return nullptr;
+        }
+
+        auto* pool = static_cast<RegionPool*>(region);
+        return pool->tag.matches(MAGIC, pool->base.getItemSize()) ? pool : nullptr;
+    }
+
+    void* pop() noexcept {
+        return base.pop();
+    }
+
+    bool push(void* item) noexcept {
+        return base.push(item);
+    }
+
+    void reset() noexcept {
+        base.reset();
+    }
+
+    std::size_t getFreeCount() const noexcept {
+        return base.getFreeCount();
+    }
+
+    std::size_t capacity() const noexcept {
+        return base.size();
+    }
+
+    std::size_t getCount() const noexcept {
+        return capacity() - getFreeCount();
+    }
+
+    std::size_t getItemSize() const noexcept {
+        return base.getItemSize();
+    }
+
+  private:
+
+    RegionPool(void* items, std::size_t itemSize, std::size_t n) noexcept :
+        tag {MAGIC, static_cast<std::uint32_t>(itemSize)},
+        base {items, itemSize, n} {}
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_REGIONPOOL_H_
@@ -0,0 +1,297 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_RELOCATABLEMAP_H_
+#define ETL_RELOCATABLEMAP_H_
+
+#include <etl/base/OffsetPtr.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+namespace Relocatable {
+
+/**
+Ordered map placed into a caller-provided memory region, e.g. shared memory.
+The elements are kept in a sorted array after the header, referenced by offset,
+so the region can be mapped or copied to any other address and looked up there
+in place after `attach()`. Lookup is a binary search, inserting and erasing
+shift the elements after the position. The capacity is set by the size of the region.
+\note The comparison has to give the same result in all the processes sharing the region.
+\note Modifications are not synchronized between the processes sharing the region.
+\tparam K key type, trivially copyable
+\tparam E element type, trivially copyable
+\tparam C key compare type
+*/
+template<class K, class E, class C = std::less<K>>
+class Map {
+
+    static_assert(is_trivially_copyable<K>::value, "K shall be trivially copyable");
+    static_assert(is_trivially_copyable<E>::value, "E shall be trivially copyable");
+
+  public:  // types
+
+    /// Trivially copyable replacement of `std::pair<const K, E>`.
+    struct value_type {
+        K first;
+        E second;
+    };
+
+    using key_type = K;
+    using mapped_type = E;
+    using key_compare = C;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+    using size_type = std::size_t;
+
+  public:  // constants
+
+    static constexpr std::uint32_t MAGIC {0x45544C4DU};  // 'ETLM'
+
+  private:  // variables
+
+    Detail::RegionTag tag;
+    size_type size_;
+    size_type capacity_;
+    Detail::OffsetPtr<value_type> data_;
+
+  public:  // functions
+
+    Map(const Map& other) = delete;
+    Map& operator=(const Map& other) = delete;
+    Map(Map&& other) = delete;
+    Map& operator=(Map&& other) = delete;
+    ~Map() = default;
+
+    /// Returns the region size needed for `n` elements.
+    static constexpr size_type requiredSize(size_type n) noexcept {
+        return sizeof(Map) + alignof(value_type) + (n * sizeof(value_type));
+    }
+
+    /// Creates an empty map in the region.
+    /// \param region start of the region, aligned to `alignof(Map)`
+    /// \param size size of the region in bytes
+    /// \return the map at the start of the region, `nullptr` when no element fits
+    static Map* create(void* region, size_type size) noexcept {
+
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(Map))
+            || (size < sizeof(Map))) {
+            return nullptr;
+        }
+
+        auto* const start = static_cast<std::uint8_t*>(region);
+        auto* const items = static_cast<std::uint8_t*>(
+            Detail::alignUp(start + sizeof(Map), alignof(value_type)));
+        const size_type used = static_cast<size_type>(items - start);
+        const size_type n = (used < size) ? ((size - used) / sizeof(value_type)) : 0U;
+
+        if (n == 0U) {
+            return nullptr;
+        }
+
+        return new (region) Map {reinterpret_cast<value_type*>(items), n};
+    }
+
+    /// Returns the map created in the region, `nullptr` when the region holds no map of `K, E`.
+    static Map* attach(void* region) noexcept {
+        return const_cast<Map*>(attach(static_cast<const void*>(region)));
+    }
+
+    static const Map* attach(const void* region) noexcept {
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(Map))) {
+            return nullptr;
+        }
+
+        const auto* map = static_cast<const Map*>(region);
+        return map->tag.matches(MAGIC, sizeof(value_type)) ? map : nullptr;
+    }
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return data_.get();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.get();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return data_.get() + size_;
+    }
+
+    const_iterator end() const noexcept {
+        return data_.get() + size_;
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type max_size() const noexcept {
+        return capacity_;
+    }
+    /// \}
+
+    /// \name Lookup
+    /// \{
+    iterator lower_bound(const K& key) noexcept {
+        return const_cast<iterator>(static_cast<const Map*>(this)->lower_bound(key));
+    }
+
+    const_iterator lower_bound(const K& key) const noexcept {
+        return std::lower_bound(begin(), end(), key, [](const value_type& item, const K& k) {
+            return C {}(item.first, k);
+        });
+    }
+
+    iterator find(const K& key) noexcept {
+        return const_cast<iterator>(static_cast<const Map*>(this)->find(key));
+    }
+
+    const_iterator find(const K& key) const noexcept {
+        const_iterator it = lower_bound(key);
+        return ((it != end()) && !C {}(key, it->first)) ? it : end();
+    }
+
+    size_type count(const K& key) const noexcept {
+        return (find(key) != end()) ? 1U : 0U;
+    }
+
+    /// Returns a pointer to the element of `key`, `nullptr` when not found.
+    E* getItem(const K& key) noexcept {
+        auto it = find(key);
+        return (it != end()) ? &it->second : nullptr;
+    }
+
+    const E* getItem(const K& key) const noexcept {
+        auto it = find(key);
+        return (it != end()) ? &it->second : nullptr;
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    /// Inserts an element when `key` is not found.
+    /// \return iterator to the element of `key` and `true` if inserted;
+    ///         `end()` and `false` when full
+    std::pair<iterator, bool> insert(const K& key, const E& elem) noexcept;
+
+    std::pair<iterator, bool> insert_or_assign(const K& key, const E& elem) noexcept {
+        auto it = find(key);
+        if (it != end()) {
+            it->second = elem;
+            return {it, false};
+        }
+
+        return insert(key, elem);
+    }
+
+    size_type erase(const K& key) noexcept;
+
+    void clear() noexcept {
+        size_ = 0U;
+    }
+    /// \}
+
+  private:
+
+    Map(value_type* items, size_type n) noexcept :
+        tag {MAGIC, sizeof(value_type)},
+        size_ {0U},
+        capacity_ {n},
+        data_ {items} {}
+};
+
+template<class K, class E, class C>
+constexpr std::uint32_t Map<K, E, C>::MAGIC;
+
+
+template<class K, class E, class C>
+auto Map<K, E, C>::insert(const K& key, const E& elem) noexcept -> std::pair<iterator, bool> {
+
+    iterator pos = lower_bound(key);
+    if ((pos != end()) && !C {}(key, pos->first)) {
+        return {pos, false};
+    }
+
+    if (size_ >= capacity_) {
+        return {end(), false};
+    }
+
+    std::memmove(static_cast<void*>(pos + 1),
+                 static_cast<const void*>(pos),
+                 static_cast<size_type>(end() - pos) * sizeof(value_type));
+    pos->first = key;
+    pos->second = elem;
+    ++size_;
+
+    return {pos, true};
+}
+
+
+template<class K, class E, class C>
+auto Map<K, E, C>::erase(const K& key) noexcept -> size_type {
+
+    iterator pos = find(key);
+    if (pos == end()) {
+        return 0U;
+    }
+
+    std::memmove(static_cast<void*>(pos),
+                 static_cast<const void*>(pos + 1),
+                 static_cast<size_type>(end() - (pos + 1)) * sizeof(value_type));
+    --size_;
+
+    return 1U;
+}
+
+}  // namespace Relocatable
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_RELOCATABLEMAP_H_
@@ -0,0 +1,439 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_RELOCATABLEUNORDEREDMAP_H_
+#define ETL_RELOCATABLEUNORDEREDMAP_H_
+
+#include <etl/base/OffsetPoolBase.h>
+#include <etl/base/OffsetPtr.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+namespace Relocatable {
+
+/**
+Hash map placed into a caller-provided memory region, e.g. shared memory.
+The header, the buckets and the node pool are put into the region, all the links are
+stored as offsets, so the region can be mapped or copied to any other address and
+looked up there in place after `attach()`. The capacity is set by the size of the region.
+\note The hash has to give the same result in all the processes sharing the region.
+\note Modifications are not synchronized between the processes sharing the region.
+\tparam K key type, trivially copyable
+\tparam E element type, trivially copyable
+\tparam H hash type
+\tparam KE 'key equal' type
+*/
+template<class K, class E, class H = std::hash<K>, class KE = std::equal_to<K>>
+class UnorderedMap {
+
+    static_assert(is_trivially_copyable<K>::value, "K shall be trivially copyable");
+    static_assert(is_trivially_copyable<E>::value, "E shall be trivially copyable");
+
+  public:  // types
+
+    /// Trivially copyable replacement of `std::pair<const K, E>`.
+    struct value_type {
+        K first;
+        E second;
+    };
+
+    using key_type = K;
+    using mapped_type = E;
+    using size_type = std::size_t;
+    using hasher = H;
+    using key_equal = KE;
+
+    struct Node {
+        Detail::OffsetPtr<Node> next;
+        std::size_t hash;
+        value_type item;
+    };
+
+    template<class NT, class VT>
+    class Iterator {
+
+        friend class UnorderedMap;
+
+      public:  // types
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = VT;
+        using difference_type = std::ptrdiff_t;
+        using pointer = VT*;
+        using reference = VT&;
+
+      private:  // variables
+
+        const Detail::OffsetPtr<Node>* bucket;
+        const Detail::OffsetPtr<Node>* bucketsEnd;
+        NT* node;
+
+      public:  // functions
+
+        Iterator() noexcept :
+            bucket {nullptr},
+            bucketsEnd {nullptr},
+            node {nullptr} {}
+
+        template<class NT2, class VT2>
+        Iterator(const Iterator<NT2, VT2>& other) noexcept :
+            bucket {other.bucket},
+            bucketsEnd {other.bucketsEnd},
+            node {other.node} {}
+
+        reference operator*() const noexcept {
+            return node->item;
+        }
+
+        pointer operator->() const noexcept {
+            return &node->item;
+        }
+
+        Iterator& operator++() noexcept {
+            node = node->next.get();
+            if (node == nullptr) {
+                ++bucket;
+                seekNode();
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator& other) const noexcept {
+            return !operator==(other);
+        }
+
+      private:
+
+        Iterator(const Detail::OffsetPtr<Node>* b, const Detail::OffsetPtr<Node>* e, NT* n) noexcept :
+            bucket {b},
+            bucketsEnd {e},
+            node {n} {}
+
+        void seekNode() noexcept {
+            while ((bucket != bucketsEnd) && !*bucket) {
+                ++bucket;
+            }
+            node = (bucket != bucketsEnd) ? bucket->get() : nullptr;
+        }
+
+        template<class NT2, class VT2>
+        friend class Iterator;
+    };
+
+    using iterator = Iterator<Node, value_type>;
+    using const_iterator = Iterator<const Node, const value_type>;
+
+  public:  // constants
+
+    static constexpr std::uint32_t MAGIC {0x45544C55U};  // 'ETLU'
+
+  private:  // types
+
+    using Bucket = Detail::OffsetPtr<Node>;
+
+  private:  // variables
+
+    Detail::RegionTag tag;
+    size_type size_;
+    size_type bucketCnt;
+    Detail::OffsetPtr<Bucket> buckets;
+    Detail::OffsetPoolBase pool;
+
+  public:  // functions
+
+    UnorderedMap(const UnorderedMap& other) = delete;
+    UnorderedMap& operator=(const UnorderedMap& other) = delete;
+    UnorderedMap(UnorderedMap&& other) = delete;
+    UnorderedMap& operator=(UnorderedMap&& other) = delete;
+    ~UnorderedMap() = default;
+
+    /// Returns the region size needed for `n` elements and `bucketCount` buckets.
+    static constexpr size_type requiredSize(size_type n, size_type bucketCount) noexcept {
+        return sizeof(UnorderedMap) + (bucketCount * sizeof(Bucket)) + alignof(Node)
+               + (n * sizeof(Node));
+    }
+
+    /// Creates an empty map in the region.
+    /// \param region start of the region, aligned to `alignof(UnorderedMap)`
+    /// \param size size of the region in bytes
+    /// \param bucketCount number of buckets, fixed for the lifetime of the map
+    /// \return the map at the start of the region, `nullptr` when no element fits
+    static UnorderedMap* create(void* region, size_type size, size_type bucketCount) noexcept;
+
+    /// Returns the map created in the region, `nullptr` when the region holds no map of `K, E`.
+    static UnorderedMap* attach(void* region) noexcept {
+        return const_cast<UnorderedMap*>(attach(static_cast<const void*>(region)));
+    }
+
+    static const UnorderedMap* attach(const void* region) noexcept {
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(UnorderedMap))) {
+            return nullptr;
+        }
+
+        const auto* map = static_cast<const UnorderedMap*>(region);
+        return map->tag.matches(MAGIC, sizeof(Node)) ? map : nullptr;
+    }
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        iterator it {buckets.get(), bucketsEnd(), nullptr};
+        it.seekNode();
+        return it;
+    }
+
+    const_iterator begin() const noexcept {
+        const_iterator it {buckets.get(), bucketsEnd(), nullptr};
+        it.seekNode();
+        return it;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator {bucketsEnd(), bucketsEnd(), nullptr};
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator {bucketsEnd(), bucketsEnd(), nullptr};
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type max_size() const noexcept {
+        return pool.size();
+    }
+
+    size_type bucket_count() const noexcept {
+        return bucketCnt;
+    }
+    /// \}
+
+    /// \name Lookup
+    /// \{
+    iterator find(const K& key) noexcept {
+        const_iterator it = static_cast<const UnorderedMap*>(this)->find(key);
+        return iterator {it.bucket, it.bucketsEnd, const_cast<Node*>(it.node)};
+    }
+
+    const_iterator find(const K& key) const noexcept;
+
+    size_type count(const K& key) const noexcept {
+        return (find(key) != end()) ? 1U : 0U;
+    }
+
+    /// Returns a pointer to the element of `key`, `nullptr` when not found.
+    E* getItem(const K& key) noexcept {
+        auto it = find(key);
+        return (it != end()) ? &it->second : nullptr;
+    }
+
+    const E* getItem(const K& key) const noexcept {
+        auto it = find(key);
+        return (it != end()) ? &it->second : nullptr;
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    /// Inserts an element when `key` is not found.
+    /// \return iterator to the element of `key` and `true` if inserted; `end()` and `false` when full
+    std::pair<iterator, bool> insert(const K& key, const E& elem) noexcept;
+
+    std::pair<iterator, bool> insert_or_assign(const K& key, const E& elem) noexcept {
+        auto it = find(key);
+        if (it != end()) {
+            it->second = elem;
+            return {it, false};
+        }
+
+        return insert(key, elem);
+    }
+
+    size_type erase(const K& key) noexcept;
+
+    void clear() noexcept {
+        Bucket* b = buckets.get();
+        for (size_type i = 0U; i < bucketCnt; ++i) {
+            b[i] = nullptr;
+        }
+
+        pool.reset();
+        size_ = 0U;
+    }
+    /// \}
+
+  private:
+
+    UnorderedMap(Bucket* b, size_type bc, void* nodes, size_type n) noexcept :
+        tag {MAGIC, sizeof(Node)},
+        size_ {0U},
+        bucketCnt {bc},
+        buckets {b},
+        pool {nodes, sizeof(Node), n} {}
+
+    const Bucket* bucketsEnd() const noexcept {
+        return buckets.get() + bucketCnt;
+    }
+
+    Bucket& bucketOf(std::size_t hash) noexcept {
+        return buckets.get()[hash % bucketCnt];
+    }
+
+    const Bucket& bucketOf(std::size_t hash) const noexcept {
+        return buckets.get()[hash % bucketCnt];
+    }
+};
+
+template<class K, class E, class H, class KE>
+constexpr std::uint32_t UnorderedMap<K, E, H, KE>::MAGIC;
+
+
+template<class K, class E, class H, class KE>
+auto UnorderedMap<K, E, H, KE>::create(void* region, size_type size, size_type bucketCount) noexcept
+    -> UnorderedMap* {
+
+    if ((region == nullptr) || !Detail::isAligned(region, alignof(UnorderedMap))
+        || (bucketCount == 0U) || (size < sizeof(UnorderedMap))) {
+        return nullptr;
+    }
+
+    static_assert((sizeof(Node) % alignof(Detail::OffsetPoolBase::FreeItem)) == 0U,
+                  "Invalid node layout");
+
+    auto* const start = static_cast<std::uint8_t*>(region);
+    auto* const bucketStart =
+        static_cast<std::uint8_t*>(Detail::alignUp(start + sizeof(UnorderedMap), alignof(Bucket)));
+    auto* const nodes = static_cast<std::uint8_t*>(
+        Detail::alignUp(bucketStart + (bucketCount * sizeof(Bucket)), alignof(Node)));
+    const size_type used = static_cast<size_type>(nodes - start);
+    const size_type n = (used < size) ? ((size - used) / sizeof(Node)) : 0U;
+
+    if (n == 0U) {
+        return nullptr;
+    }
+
+    auto* b = reinterpret_cast<Bucket*>(bucketStart);
+    for (size_type i = 0U; i < bucketCount; ++i) {
+        new (&b[i]) Bucket {};
+    }
+
+    return new (region) UnorderedMap {b, bucketCount, nodes, n};
+}
+
+
+template<class K, class E, class H, class KE>
+auto UnorderedMap<K, E, H, KE>::find(const K& key) const noexcept -> const_iterator {
+
+    const std::size_t hash = H {}(key);
+    const Bucket& bucket = bucketOf(hash);
+
+    const Node* node = bucket.get();
+    while ((node != nullptr) && !((node->hash == hash) && KE {}(node->item.first, key))) {
+        node = node->next.get();
+    }
+
+    return (node != nullptr) ? const_iterator {&bucket, bucketsEnd(), node} : end();
+}
+
+
+template<class K, class E, class H, class KE>
+auto UnorderedMap<K, E, H, KE>::insert(const K& key, const E& elem) noexcept
+    -> std::pair<iterator, bool> {
+
+    auto it = find(key);
+    if (it != end()) {
+        return {it, false};
+    }
+
+    void* mem = pool.pop();
+    if (mem == nullptr) {
+        return {end(), false};
+    }
+
+    const std::size_t hash = H {}(key);
+    Bucket& bucket = bucketOf(hash);
+
+    Node* node = new (mem) Node {bucket, hash, {key, elem}};
+    bucket = node;
+    ++size_;
+
+    return {iterator {&bucket, bucketsEnd(), node}, true};
+}
+
+
+template<class K, class E, class H, class KE>
+auto UnorderedMap<K, E, H, KE>::erase(const K& key) noexcept -> size_type {
+
+    const std::size_t hash = H {}(key);
+    Bucket* link = &bucketOf(hash);
+
+    while (*link) {
+        Node* node = link->get();
+        if ((node->hash == hash) && KE {}(node->item.first, key)) {
+            *link = node->next;
+            pool.push(node);
+            --size_;
+            return 1U;
+        }
+        link = &node->next;
+    }
+
+    return 0U;
+}
+
+}  // namespace Relocatable
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_RELOCATABLEUNORDEREDMAP_H_
@@ -0,0 +1,226 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_RELOCATABLEVECTOR_H_
+#define ETL_RELOCATABLEVECTOR_H_
+
+#include <etl/base/OffsetPtr.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <cstddef>
+#include <new>
+
+namespace ETL_NAMESPACE {
+namespace Relocatable {
+
+/**
+Vector placed into a caller-provided memory region, e.g. shared memory.
+The header and the elements are put into the region, the data is referenced by offset,
+so the region can be mapped or copied to any other address and read there in place
+after `attach()`. The capacity is set by the size of the region.
+\tparam T element type, trivially copyable
+*/
+template<class T>
+class Vector {
+
+    static_assert(is_trivially_copyable<T>::value, "T shall be trivially copyable");
+
+  public:  // types
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = std::size_t;
+
+  public:  // constants
+
+    static constexpr std::uint32_t MAGIC {0x45544C56U};  // 'ETLV'
+
+  private:  // variables
+
+    Detail::RegionTag tag;
+    size_type size_;
+    size_type capacity_;
+    Detail::OffsetPtr<T> data_;
+
+  public:  // functions
+
+    Vector(const Vector& other) = delete;
+    Vector& operator=(const Vector& other) = delete;
+    Vector(Vector&& other) = delete;
+    Vector& operator=(Vector&& other) = delete;
+    ~Vector() = default;
+
+    /// Returns the region size needed for `n` elements.
+    static constexpr size_type requiredSize(size_type n) noexcept {
+        return sizeof(Vector) + alignof(T) + (n * sizeof(T));
+    }
+
+    /// Creates an empty vector in the region.
+    /// \param region start of the region, aligned to `alignof(Vector)`
+    /// \param size size of the region in bytes
+    /// \return the vector at the start of the region, `nullptr` when no element fits
+    static Vector* create(void* region, size_type size) noexcept {
+
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(Vector))
+            || (size < sizeof(Vector))) {
+            return nullptr;
+        }
+
+        auto* const start = static_cast<std::uint8_t*>(region);
+        auto* const items =
+            static_cast<std::uint8_t*>(Detail::alignUp(start + sizeof(Vector), alignof(T)));
+        const size_type used = static_cast<size_type>(items - start);
+        const size_type n = (used < size) ? ((size - used) / sizeof(T)) : 0U;
+
+        if (n == 0U) {
+            return nullptr;
+        }
+
+        return new (region) Vector {reinterpret_cast<T*>(items), n};
+    }
+
+    /// Returns the vector created in the region, `nullptr` when the region holds no vector of `T`.
+    static Vector* attach(void* region) noexcept {
+        return const_cast<Vector*>(attach(static_cast<const void*>(region)));
+    }
+
+    static const Vector* attach(const void* region) noexcept {
+        if ((region == nullptr) || !Detail::isAligned(region, alignof(Vector))) {
+            return nullptr;
+        }
+
+        const auto* vec = static_cast<const Vector*>(region);
+        return vec->tag.matches(MAGIC, sizeof(T)) ? vec : nullptr;
+    }
+
+    /// \name Element access
+    /// \{
+    reference operator[](size_type ix) noexcept {
+        ETL_ASSERT(ix < size_);
+        return data_.get()[ix];
+    }
+
+    const_reference operator[](size_type ix) const noexcept {
+        ETL_ASSERT(ix < size_);
+        return data_.get()[ix];
+    }
+
+    pointer data() noexcept {
+        return data_.get();
+    }
+
+    const_pointer data() const noexcept {
+        return data_.get();
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return data();
+    }
+
+    const_iterator begin() const noexcept {
+        return data();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data();
+    }
+
+    iterator end() noexcept {
+        return data() + size_;
+    }
+
+    const_iterator end() const noexcept {
+        return data() + size_;
+    }
+
+    const_iterator cend() const noexcept {
+        return data() + size_;
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return size_ == 0U;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    size_type max_size() const noexcept {
+        return capacity_;
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    /// Appends an element, returns `false` when the vector is full.
+    bool push_back(const_reference value) noexcept {
+        if (size_ >= capacity_) {
+            return false;
+        }
+
+        data_.get()[size_] = value;
+        ++size_;
+        return true;
+    }
+
+    void pop_back() noexcept {
+        ETL_ASSERT(size_ > 0U);
+        --size_;
+    }
+
+    void clear() noexcept {
+        size_ = 0U;
+    }
+    /// \}
+
+  private:
+
+    Vector(T* items, size_type n) noexcept :
+        tag {MAGIC, sizeof(T)},
+        size_ {0U},
+        capacity_ {n},
+        data_ {items} {}
+};
+
+template<class T>
+constexpr std::uint32_t Vector<T>::MAGIC;
+
+}  // namespace Relocatable
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_RELOCATABLEVECTOR_H_
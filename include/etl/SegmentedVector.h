@@ -0,0 +1,366 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_SEGMENTEDVECTOR_H_
+#define ETL_SEGMENTEDVECTOR_H_
+
+#include <etl/PoolAllocator.h>
+#include <etl/Vector.h>
+#include <etl/base/AAllocator.h>
+#include <etl/base/SegmentedVectorTemplate.h>
+#include <etl/etlSupport.h>
+
+#include <memory>
+
+namespace ETL_NAMESPACE {
+
+namespace Custom {
+
+/// Segmented vector with custom chunk allocator, the directory is allocated dynamically.
+template<class T, template<class> class A, std::size_t K = 16U>
+class SegmentedVector : public ETL_NAMESPACE::SegmentedVector<T, K> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::SegmentedVector<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Chunk = typename Base::Chunk;
+
+    using AllocatorTraits = typename Detail::AllocatorTraits<Chunk, A>;
+    using Allocator = typename AllocatorTraits::Type;
+
+  private:  // variables
+
+    ETL_NAMESPACE::Dynamic::Vector<Chunk*> directory;
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    SegmentedVector() noexcept :
+        Base {directory, allocator} {}
+
+    explicit SegmentedVector(size_type len) :
+        SegmentedVector {} {
+        this->resize(len);
+    }
+
+    SegmentedVector(size_type len, const T& item) :
+        SegmentedVector {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    SegmentedVector(InputIt first, InputIt last) :
+        SegmentedVector {} {
+        this->assign(first, last);
+    }
+
+    SegmentedVector(const SegmentedVector& other) :
+        SegmentedVector {} {
+        Base::operator=(other);
+    }
+
+    explicit SegmentedVector(const Base& other) :
+        SegmentedVector {} {
+        Base::operator=(other);
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SegmentedVector& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SegmentedVector(SegmentedVector&& other) :
+        SegmentedVector {} {
+        this->swap(other);
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    SegmentedVector(std::initializer_list<T> initList) :
+        SegmentedVector {} {
+        operator=(initList);
+    }
+
+    SegmentedVector& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~SegmentedVector() {
+        this->cleanup();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(SegmentedVector& lhs, SegmentedVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Custom
+
+
+namespace Dynamic {
+
+/// Segmented vector with dynamic memory allocation using std::allocator.
+template<class T, std::size_t K = 16U>
+using SegmentedVector = ETL_NAMESPACE::Custom::SegmentedVector<T, std::allocator, K>;
+
+}  // namespace Dynamic
+
+
+namespace Static {
+
+/// Segmented vector with unique chunk pool for N elements.
+template<class T, std::size_t N, std::size_t K = 16U>
+class SegmentedVector : public ETL_NAMESPACE::SegmentedVector<T, K> {
+
+    static_assert(N > 0, "Invalid Etl::Static::SegmentedVector<> size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::SegmentedVector<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Chunk = typename Base::Chunk;
+
+    static constexpr std::size_t NUM_OF_CHUNKS {(N + K - 1U) / K};
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<NUM_OF_CHUNKS>::template Allocator<Chunk>;
+
+  private:  // variables
+
+    ETL_NAMESPACE::Static::Vector<Chunk*, NUM_OF_CHUNKS> directory;
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    SegmentedVector() noexcept :
+        Base {directory, allocator} {}
+
+    explicit SegmentedVector(size_type len) :
+        SegmentedVector {} {
+        this->resize(len);
+    }
+
+    SegmentedVector(size_type len, const T& item) :
+        SegmentedVector {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    SegmentedVector(InputIt first, InputIt last) :
+        SegmentedVector {} {
+        this->assign(first, last);
+    }
+
+    SegmentedVector(const SegmentedVector& other) :
+        SegmentedVector {} {
+        Base::operator=(other);
+    }
+
+    explicit SegmentedVector(const Base& other) :
+        SegmentedVector {} {
+        Base::operator=(other);
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SegmentedVector& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SegmentedVector(SegmentedVector&& other) :
+        SegmentedVector {} {
+        this->swap(other);
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    SegmentedVector(std::initializer_list<T> initList) :
+        SegmentedVector {} {
+        operator=(initList);
+    }
+
+    SegmentedVector& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~SegmentedVector() {
+        this->cleanup();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(SegmentedVector& lhs, SegmentedVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Static
+
+
+namespace Pooled {
+
+/// Segmented vector with common chunk pool of NC chunks.
+template<class T, std::size_t NC, std::size_t K = 16U>
+class SegmentedVector : public ETL_NAMESPACE::SegmentedVector<T, K> {
+
+    static_assert(NC > 0, "Invalid Etl::Pooled::SegmentedVector<> size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::SegmentedVector<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Chunk = typename Base::Chunk;
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<NC>::template CommonAllocator<Chunk>;
+
+  private:  // variables
+
+    ETL_NAMESPACE::Static::Vector<Chunk*, NC> directory;
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    SegmentedVector() noexcept :
+        Base {directory, allocator} {
+        (void)allocator.handle();  // This assures to construct allocator instance before
+                                   // the first container, avoiding SIOF during static deinit.
+    }
+
+    explicit SegmentedVector(size_type len) :
+        SegmentedVector {} {
+        this->resize(len);
+    }
+
+    SegmentedVector(size_type len, const T& item) :
+        SegmentedVector {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    SegmentedVector(InputIt first, InputIt last) :
+        SegmentedVector {} {
+        this->assign(first, last);
+    }
+
+    SegmentedVector(const SegmentedVector& other) :
+        SegmentedVector {} {
+        Base::operator=(other);
+    }
+
+    explicit SegmentedVector(const Base& other) :
+        SegmentedVector {} {
+        Base::operator=(other);
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SegmentedVector& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SegmentedVector(SegmentedVector&& other) :
+        SegmentedVector {} {
+        this->swap(other);
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    SegmentedVector(std::initializer_list<T> initList) :
+        SegmentedVector {} {
+        operator=(initList);
+    }
+
+    SegmentedVector& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~SegmentedVector() {
+        this->cleanup();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(SegmentedVector& lhs, SegmentedVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Pooled
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_SEGMENTEDVECTOR_H_
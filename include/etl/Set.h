@@ -200,6 +200,17 @@ class Set : public ETL_NAMESPACE::Set<E, C> {
         this->clear();
     }
 
+    /// Destroys all elements. Trivially destructible elements are released
+    /// at once by resetting the own pool.
+    void clear() noexcept(noexcept(std::declval<Base>().clear())) {
+        if (std::is_trivially_destructible<typename Base::value_type>::value) {
+            this->dropNodes();
+            allocator.reset();
+        } else {
+            Base::clear();
+        }
+    }
+
     Allocator& getAllocator() const noexcept {
         return allocator;
     }
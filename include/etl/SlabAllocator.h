@@ -0,0 +1,252 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_SLABALLOCATOR_H_
+#define ETL_SLABALLOCATOR_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/SlabBase.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace ETL_NAMESPACE {
+
+/**
+Allocator template class over a common slab region.
+Implements AAllocator for any `n`, so it serves both the nodes of node based
+containers and the storage of `Vector`-like ones. All instances with the same
+region type `R` share the region, independently of `T`.
+\tparam T Item type
+\tparam R Region type, e.g. StaticSlab or DynamicSlab
+*/
+template<class T, class R>
+class SlabAllocator : public AAllocator<T> {
+
+  public:  // types
+
+    using ItemType = T;
+    using PtrType = T*;
+    using Region = R;
+
+    static constexpr bool uniqueAllocator = false;
+
+  public:  // functions
+
+    SlabAllocator() noexcept {
+        (void)R::slab();  // The region has to outlive the containers using it.
+    }
+
+    std::size_t max_size() const noexcept override {
+        return R::slab().capacity() / sizeof(T);
+    }
+
+    /// Returns the number of items of type `T` allocated from the region.
+    std::size_t size() const noexcept override {
+        auto lg = Detail::lock(R::lock());
+        return count();
+    }
+
+    std::size_t reserve() const noexcept override {
+        auto lg = Detail::lock(R::lock());
+        return R::slab().available(sizeof(T));
+    }
+
+    PtrType allocate(std::size_t n) override {
+        if ((n == 0U) || (n > (std::numeric_limits<std::size_t>::max() / sizeof(T)))) {
+            return nullptr;
+        }
+
+        auto lg = Detail::lock(R::lock());
+        void* ptr = R::slab().allocate(n * sizeof(T), alignof(T));
+        if (ptr != nullptr) {
+            count() += n;
+        }
+
+        return static_cast<PtrType>(ptr);
+    }
+
+    void deallocate(PtrType ptr, std::size_t n) noexcept override {
+        if (ptr != nullptr) {
+            auto lg = Detail::lock(R::lock());
+            R::slab().deallocate(ptr, n * sizeof(T));
+            count() -= n;
+        }
+    }
+
+    /// Allocates up to `n` single items taking the lock once.
+    std::size_t allocate_bulk(std::size_t n, PtrType* out) override {
+        auto lg = Detail::lock(R::lock());
+        std::size_t cnt = 0U;
+        while (cnt < n) {
+            void* ptr = R::slab().allocate(sizeof(T), alignof(T));
+            if (ptr == nullptr) {
+                break;
+            }
+            out[cnt] = static_cast<PtrType>(ptr);
+            ++cnt;
+        }
+
+        count() += cnt;
+        return cnt;
+    }
+
+    /// Deallocates `n` single items taking the lock once.
+    void deallocate_bulk(PtrType* ptrs, std::size_t n) noexcept override {
+        auto lg = Detail::lock(R::lock());
+        for (std::size_t i = 0U; i < n; ++i) {
+            R::slab().deallocate(ptrs[i], sizeof(T));
+        }
+
+        count() -= n;
+    }
+
+    const void* handle() const noexcept override {
+        return &R::slab();
+    }
+
+  private:
+
+    static std::size_t& count() noexcept {
+        static std::size_t cnt {0U};
+        return cnt;
+    }
+};
+
+
+/// Size class configuration of the slab regions, selecting the power-of-two classes.
+struct DefaultSlabClasses {
+
+    static constexpr std::size_t COUNT {0U};
+
+    static const std::size_t* sizes() noexcept {
+        return nullptr;
+    }
+};
+
+
+/**
+Static slab region of `S` bytes.
+\tparam S Size of the region in bytes, including the page bookkeeping
+\tparam P Page size, a power of two
+\tparam L Lock type, defaults to std::mutex
+\tparam C Size class configuration with `COUNT` ascending block sizes returned by `sizes()`
+*/
+template<std::size_t S, std::size_t P = 256U, class L = std::mutex, class C = DefaultSlabClasses>
+class StaticSlab {
+
+    static_assert((P >= (2U * Detail::SlabBase::MIN_BLOCK)) && ((P & (P - 1U)) == 0U),
+                  "Invalid page size");
+    static_assert(S >= (P + Detail::SlabBase::PAGE_INFO_SIZE + Detail::SlabBase::MAX_ALIGN),
+                  "Region smaller than a page");
+
+  public:  // types
+
+    using Lock = L;
+
+    template<class T>
+    class Allocator : public SlabAllocator<T, StaticSlab> {};
+
+  private:  // types
+
+    struct Instance {
+        alignas(Detail::SlabBase::MAX_ALIGN) uint8_t data[S];
+        Detail::SlabBase base {data, S, P, C::sizes(), C::COUNT};
+        Lock l {};
+    };
+
+  public:  // functions
+
+    static Detail::SlabBase& slab() noexcept {
+        return instance().base;
+    }
+
+    static Lock& lock() noexcept {
+        return instance().l;
+    }
+
+  private:
+
+    static Instance& instance() noexcept {
+        static Instance inst;
+        return inst;
+    }
+};
+
+
+/**
+Slab region of `S` bytes allocated on the heap at first use.
+\tparam S Size of the region in bytes, including the page bookkeeping
+\tparam P Page size, a power of two
+\tparam L Lock type, defaults to std::mutex
+\tparam C Size class configuration with `COUNT` ascending block sizes returned by `sizes()`
+*/
+template<std::size_t S, std::size_t P = 256U, class L = std::mutex, class C = DefaultSlabClasses>
+class DynamicSlab {
+
+    static_assert((P >= (2U * Detail::SlabBase::MIN_BLOCK)) && ((P & (P - 1U)) == 0U),
+                  "Invalid page size");
+    static_assert(S >= (P + Detail::SlabBase::PAGE_INFO_SIZE + Detail::SlabBase::MAX_ALIGN),
+                  "Region smaller than a page");
+
+  public:  // types
+
+    using Lock = L;
+
+    template<class T>
+    class Allocator : public SlabAllocator<T, DynamicSlab> {};
+
+  private:  // types
+
+    using Unit = std::max_align_t;
+
+    struct Instance {
+        std::unique_ptr<Unit[]> data {new Unit[(S + sizeof(Unit) - 1U) / sizeof(Unit)]};
+        Detail::SlabBase base {data.get(), S, P, C::sizes(), C::COUNT};
+        Lock l {};
+    };
+
+  public:  // functions
+
+    static Detail::SlabBase& slab() noexcept {
+        return instance().base;
+    }
+
+    static Lock& lock() noexcept {
+        return instance().l;
+    }
+
+  private:
+
+    static Instance& instance() noexcept {
+        static Instance inst;
+        return inst;
+    }
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_SLABALLOCATOR_H_
@@ -0,0 +1,190 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_SOAVECTOR_H_
+#define ETL_SOAVECTOR_H_
+
+#include <etl/Vector.h>
+#include <etl/base/SoAVectorTemplate.h>
+#include <etl/etlSupport.h>
+
+#include <memory>
+#include <tuple>
+
+namespace ETL_NAMESPACE {
+
+namespace Custom {
+
+/// Structure-of-arrays container with custom allocator for the columns.
+template<template<class> class A, class... Ts>
+class SoAVector : public ETL_NAMESPACE::SoAVector<Ts...> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::SoAVector<Ts...>;
+    using size_type = typename Base::size_type;
+
+    using Columns = std::tuple<ETL_NAMESPACE::Custom::Vector<Ts, A>...>;
+
+  private:  // variables
+
+    Columns storage;
+
+  public:  // functions
+
+    SoAVector() noexcept {
+        this->bind(storage);
+    }
+
+    explicit SoAVector(size_type len) :
+        SoAVector {} {
+        this->resize(len);
+    }
+
+    SoAVector(const SoAVector& other) :
+        SoAVector {} {
+        Base::operator=(other);
+    }
+
+    explicit SoAVector(const Base& other) :
+        SoAVector {} {
+        Base::operator=(other);
+    }
+
+    SoAVector& operator=(const SoAVector& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SoAVector& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SoAVector(SoAVector&& other) :
+        SoAVector {} {
+        this->swap(other);
+    }
+
+    SoAVector& operator=(SoAVector&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    ~SoAVector() = default;
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(SoAVector& lhs, SoAVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Custom
+
+
+namespace Dynamic {
+
+/// Structure-of-arrays container with dynamic memory allocation using std::allocator.
+template<class... Ts>
+using SoAVector = ETL_NAMESPACE::Custom::SoAVector<std::allocator, Ts...>;
+
+}  // namespace Dynamic
+
+
+namespace Static {
+
+/// Structure-of-arrays container with static columns for N rows.
+template<std::size_t N, class... Ts>
+class SoAVector : public ETL_NAMESPACE::SoAVector<Ts...> {
+
+    static_assert(N > 0, "Invalid Etl::Static::SoAVector<> size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::SoAVector<Ts...>;
+    using size_type = typename Base::size_type;
+
+    using Columns = std::tuple<ETL_NAMESPACE::Static::Vector<Ts, N>...>;
+
+  private:  // variables
+
+    Columns storage;
+
+  public:  // functions
+
+    SoAVector() noexcept {
+        this->bind(storage);
+    }
+
+    explicit SoAVector(size_type len) :
+        SoAVector {} {
+        this->resize(len);
+    }
+
+    SoAVector(const SoAVector& other) :
+        SoAVector {} {
+        Base::operator=(other);
+    }
+
+    explicit SoAVector(const Base& other) :
+        SoAVector {} {
+        Base::operator=(other);
+    }
+
+    SoAVector& operator=(const SoAVector& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SoAVector& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    SoAVector(SoAVector&& other) :
+        SoAVector {} {
+        this->swap(other);
+    }
+
+    SoAVector& operator=(SoAVector&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    ~SoAVector() = default;
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(SoAVector& lhs, SoAVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Static
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_SOAVECTOR_H_
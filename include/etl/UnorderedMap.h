@@ -249,6 +249,17 @@ class UnorderedMap : public ETL_NAMESPACE::UnorderedMap<K, E, H, KE> {
         this->clear();
     }
 
+    /// Destroys all elements. Trivially destructible elements are released
+    /// at once by resetting the own pool.
+    void clear() noexcept(noexcept(std::declval<Base>().clear())) {
+        if (std::is_trivially_destructible<typename Base::value_type>::value) {
+            this->dropNodes();
+            allocator.reset();
+        } else {
+            Base::clear();
+        }
+    }
+
     void swap(UnorderedMap& other) noexcept(noexcept(UnorderedMap().swapSameType(other))) {
         if (&other != this) {
             swapSameType(other);
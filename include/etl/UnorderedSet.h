@@ -242,6 +242,17 @@ class UnorderedSet : public ETL_NAMESPACE::UnorderedSet<K, H, KE> {
         this->clear();
     }
 
+    /// Destroys all elements. Trivially destructible elements are released
+    /// at once by resetting the own pool.
+    void clear() noexcept(noexcept(std::declval<Base>().clear())) {
+        if (std::is_trivially_destructible<typename Base::value_type>::value) {
+            this->dropNodes();
+            allocator.reset();
+        } else {
+            Base::clear();
+        }
+    }
+
     void swap(UnorderedSet& other) noexcept(noexcept(UnorderedSet().swapSameType(other))) {
         if (&other != this) {
             swapSameType(other);
@@ -0,0 +1,388 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_UNROLLEDLIST_H_
+#define ETL_UNROLLEDLIST_H_
+
+#include <etl/PoolAllocator.h>
+#include <etl/base/AAllocator.h>
+#include <etl/base/UnrolledListTemplate.h>
+#include <etl/etlSupport.h>
+
+#include <memory>
+
+namespace ETL_NAMESPACE {
+
+namespace Custom {
+
+/// UnrolledList with custom allocator.
+template<class T, template<class> class A, std::size_t K = 16U>
+class UnrolledList : public ETL_NAMESPACE::UnrolledList<T, K> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::UnrolledList<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+    using Node = typename Base::Node;
+
+    using AllocatorTraits = typename Detail::AllocatorTraits<Node, A>;
+    using Allocator = typename AllocatorTraits::Type;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    UnrolledList() noexcept :
+        Base {allocator} {}
+
+    explicit UnrolledList(size_type len) :
+        UnrolledList {} {
+        this->assign(len, T {});
+    }
+
+    UnrolledList(size_type len, const T& item) :
+        UnrolledList {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    UnrolledList(InputIt first, InputIt last) :
+        UnrolledList {} {
+        this->assign(first, last);
+    }
+
+    UnrolledList(const UnrolledList& other) :
+        UnrolledList {} {
+        Base::operator=(other);
+    }
+
+    explicit UnrolledList(const Base& other) :
+        UnrolledList {} {
+        Base::operator=(other);
+    }
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    UnrolledList& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept(noexcept(UnrolledList().swap(other))) :
+        UnrolledList {} {
+        this->swap(other);
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) noexcept(noexcept(UnrolledList().swap(other))) {
+        this->swap(other);
+        return *this;
+    }
+
+    UnrolledList(std::initializer_list<T> initUnrolledList) :
+        UnrolledList {} {
+        operator=(initUnrolledList);
+    }
+
+    UnrolledList& operator=(std::initializer_list<T> initUnrolledList) {
+        Base::operator=(initUnrolledList);
+        return *this;
+    }
+
+    ~UnrolledList() {
+        this->clear();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    void swap(UnrolledList& other) noexcept {
+        static_assert(noexcept(UnrolledList().swapNodeList(other)),
+                      "noexcept contract violation");
+        static_assert(!AllocatorTraits::uniqueAllocator,
+                      "Allocator should use uniqueAllocator == false");
+        if (&other != this) {
+            Base::swapNodeList(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(UnrolledList& lhs, UnrolledList& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Custom
+
+
+namespace Dynamic {
+
+/// UnrolledList with dynamic memory allocation using std::allocator.
+template<class T, std::size_t K = 16U>
+using UnrolledList = ETL_NAMESPACE::Custom::UnrolledList<T, std::allocator, K>;
+
+}  // namespace Dynamic
+
+
+namespace Static {
+
+/// UnrolledList with unique pool allocator of `N` nodes, each holding up to `K` elements.
+template<class T, std::size_t N, std::size_t K = 16U>
+class UnrolledList : public ETL_NAMESPACE::UnrolledList<T, K> {
+
+    static_assert(N > 0, "Invalid Etl::Static::UnrolledList size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::UnrolledList<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<N>::template Allocator<typename Base::Node>;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    UnrolledList() noexcept :
+        Base {allocator} {}
+
+    explicit UnrolledList(size_type len) :
+        UnrolledList {} {
+        this->assign(len, T {});
+    }
+
+    UnrolledList(size_type len, const T& item) :
+        UnrolledList {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    UnrolledList(InputIt first, InputIt last) :
+        UnrolledList {} {
+        this->assign(first, last);
+    }
+
+    UnrolledList(const UnrolledList& other) :
+        UnrolledList {} {
+        Base::operator=(other);
+    }
+
+    explicit UnrolledList(const Base& other) :
+        UnrolledList {} {
+        Base::operator=(other);
+    }
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    UnrolledList& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept(noexcept(UnrolledList().swap(other))) :
+        UnrolledList {} {
+        this->swap(other);
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) noexcept(noexcept(UnrolledList().swap(other))) {
+        this->swap(other);
+        return *this;
+    }
+
+    UnrolledList(std::initializer_list<T> initUnrolledList) :
+        UnrolledList {} {
+        operator=(initUnrolledList);
+    }
+
+    UnrolledList& operator=(std::initializer_list<T> initUnrolledList) {
+        Base::operator=(initUnrolledList);
+        return *this;
+    }
+
+    ~UnrolledList() {
+        this->clear();
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    void swap(UnrolledList& other) noexcept(noexcept(Detail::NothrowContract<T>::nothrowIfMovable)) {
+        // Note: this operation is noexcept when T can be moved 'noexceptly',
+        // however lower level functions are not annotated with noexcept qualifier.
+        static_assert(Allocator::uniqueAllocator,
+                      "Allocator should use uniqueAllocator == true");
+        if (&other != this) {
+            Base::swap(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(UnrolledList& lhs, UnrolledList& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Static
+
+
+namespace Pooled {
+
+/// UnrolledList with common pool allocator of `N` nodes, each holding up to `K` elements.
+template<class T, std::size_t N, std::size_t K = 16U>
+class UnrolledList : public ETL_NAMESPACE::UnrolledList<T, K> {
+
+    static_assert(N > 0, "Invalid Etl::Pooled::UnrolledList size");
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::UnrolledList<T, K>;
+    using iterator = typename Base::iterator;
+    using const_iterator = typename Base::const_iterator;
+    using size_type = typename Base::size_type;
+
+    using Allocator =
+        typename ETL_NAMESPACE::PoolHelperForSize<N>::template CommonAllocator<typename Base::Node>;
+
+  private:  // variables
+
+    mutable Allocator allocator;
+
+  public:  // functions
+
+    UnrolledList() noexcept :
+        Base {allocator} {
+        (void)allocator.handle();  // This assures to construct allocator instance before
+                                   // the first container, avoiding SIOF during static deinit.
+    }
+
+    explicit UnrolledList(size_type len) :
+        UnrolledList {} {
+        this->assign(len, T {});
+    }
+
+    UnrolledList(size_type len, const T& item) :
+        UnrolledList {} {
+        this->assign(len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    UnrolledList(InputIt first, InputIt last) :
+        UnrolledList {} {
+        this->assign(first, last);
+    }
+
+    UnrolledList(const UnrolledList& other) :
+        UnrolledList {} {
+        Base::operator=(other);
+    }
+
+    explicit UnrolledList(const Base& other) :
+        UnrolledList {} {
+        Base::operator=(other);
+    }
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    UnrolledList& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept(noexcept(UnrolledList().swap(other))) :
+        UnrolledList {} {
+        this->swap(other);
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) noexcept(noexcept(UnrolledList().swap(other))) {
+        this->swap(other);
+        return *this;
+    }
+
+    UnrolledList(std::initializer_list<T> initUnrolledList) :
+        UnrolledList {} {
+        operator=(initUnrolledList);
+    }
+
+    UnrolledList& operator=(std::initializer_list<T> initUnrolledList) {
+        Base::operator=(initUnrolledList);
+        return *this;
+    }
+
+    ~UnrolledList() {
+        this->clear();
+        ETL_ASSERT(this->empty());
+    }
+
+    Allocator& getAllocator() const {
+        return allocator;
+    }
+
+    void swap(UnrolledList& other) noexcept {
+        static_assert(noexcept(UnrolledList().swapNodeList(other)),
+                      "noexcept contract violation");
+        static_assert(!Allocator::uniqueAllocator,
+                      "Allocator should use uniqueAllocator == false");
+        if (&other != this) {
+            Base::swapNodeList(other);
+        }
+    }
+
+    using Base::swap;
+
+  private:
+
+    friend void swap(UnrolledList& lhs, UnrolledList& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+};
+
+}  // namespace Pooled
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_UNROLLEDLIST_H_
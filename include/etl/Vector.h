@@ -22,6 +22,7 @@ limitations under the License.
 #ifndef ETL_VECTOR_H_
 #define ETL_VECTOR_H_
 
+#include <etl/MonotonicArena.h>
 #include <etl/base/MemStrategies.h>
 #include <etl/base/VectorTemplate.h>
 #include <etl/base/tools.h>
@@ -31,11 +32,18 @@ namespace ETL_NAMESPACE {
 
 namespace Static {
 
-/// Vector with static memory strategy.
-template<class T, size_t N>
+/**
+Vector with static memory strategy.
+\tparam A Alignment of the storage, defaults to the alignment of `T`.
+\note Alignments above `alignof(std::max_align_t)` are honored only for
+       static and automatic objects before C++17.
+*/
+template<class T, size_t N, size_t A = alignof(T)>
 class Vector : public ETL_NAMESPACE::Vector<T> {
 
     static_assert(N > 0, "Invalid Etl::Static::Vector<> size");
+    static_assert((A >= alignof(T)) && ((A & (A - 1U)) == 0U),
+                  "Invalid Etl::Static::Vector<> alignment");
 
   public:  // types
 
@@ -47,7 +55,7 @@ class Vector : public ETL_NAMESPACE::Vector<T> {
 
   private:  // variables
 
-    uint8_t data_[N * sizeof(T)];
+    alignas(A) uint8_t data_[N * sizeof(T)];
     Strategy strategy;
 
   public:  // functions
@@ -283,6 +291,105 @@ using Vector = ETL_NAMESPACE::Custom::Vector<T, std::allocator>;
 
 }  // namespace Dynamic
 
+
+namespace Arena {
+
+/// Vector allocating from a MonotonicArena, the storage is never released to the arena.
+/// Vectors on the same arena swap their storage, also via the base class.
+template<class T>
+class Vector : public ETL_NAMESPACE::Vector<T> {
+
+  public:  // types
+
+    using Base = ETL_NAMESPACE::Vector<T>;
+    using StrategyBase = typename Base::StrategyBase;
+    using Allocator = ArenaAllocator<typename StrategyBase::value_type>;
+    using Strategy = DynamicSized<StrategyBase, Allocator>;
+
+    using size_type = typename Base::size_type;
+
+  private:  // variables
+
+    Strategy strategy;
+    MonotonicArena& arena;
+
+  public:  // functions
+
+    explicit Vector(MonotonicArena& a) noexcept :
+        Base {strategy},
+        strategy {Allocator {a}},
+        arena {a} {}
+
+    Vector(MonotonicArena& a, size_type len) :
+        Vector {a} {
+        this->insertDefault(this->cbegin(), len);
+    }
+
+    Vector(MonotonicArena& a, size_type len, const T& item) :
+        Vector {a} {
+        this->insert(this->cbegin(), len, item);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    Vector(MonotonicArena& a, InputIt first, InputIt last) :
+        Vector {a} {
+        this->insert(this->cbegin(), first, last);
+    }
+
+    Vector(MonotonicArena& a, std::initializer_list<T> initList) :
+        Vector {a} {
+        operator=(initList);
+    }
+
+    /// Copies to the arena of `other`.
+    Vector(const Vector& other) :
+        Vector {other.arena} {
+        Base::operator=(other);
+    }
+
+    Vector& operator=(const Vector& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    Vector& operator=(const Base& other) {
+        Base::operator=(other);
+        return *this;
+    }
+
+    /// Binds to the arena of `other`.
+    Vector(Vector&& other) noexcept :
+        Vector {other.arena} {
+        this->swap(other);
+    }
+
+    Vector& operator=(Vector&& other) {
+        this->swap(other);
+        return *this;
+    }
+
+    Vector& operator=(Base&& other) {
+        Base::operator=(std::move(other));
+        return *this;
+    }
+
+    Vector& operator=(std::initializer_list<T> initList) {
+        Base::operator=(initList);
+        return *this;
+    }
+
+    ~Vector() {
+        strategy.cleanup(*this);
+    }
+
+    MonotonicArena& getArena() const noexcept {
+        return arena;
+    }
+};
+
+}  // namespace Arena
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_VECTOR_H_
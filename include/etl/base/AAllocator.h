@@ -56,6 +56,28 @@ class AAllocator {
 
     virtual const void* handle() const noexcept = 0;
 
+    /// Allocates up to `n` single items, storing the pointers to `out`.
+    /// \return the number of allocated items, less than `n` when the allocator is exhausted.
+    virtual std::size_t allocate_bulk(std::size_t n, PtrType* out) {
+        std::size_t cnt = 0U;
+        while (cnt < n) {
+            PtrType ptr = allocate(1U);
+            if (ptr == nullptr) {
+                break;
+            }
+            out[cnt] = ptr;
+            ++cnt;
+        }
+        return cnt;
+    }
+
+    /// Deallocates `n` single items allocated by `allocate()` or `allocate_bulk()`.
+    virtual void deallocate_bulk(PtrType* ptrs, std::size_t n) noexcept {
+        for (std::size_t i = 0U; i < n; ++i) {
+            deallocate(ptrs[i], 1U);
+        }
+    }
+
     static void construct(PtrType ptr) noexcept(noexcept(new (ptr) ItemType)) {
         new (ptr) ItemType;
     }
@@ -295,6 +295,17 @@ class AHashTable {
 
     void consume(SingleChain& chain);
 
+    /// Unlinks all nodes and clears the buckets, keeping the bucket binding.
+    void dropNodes() noexcept {
+        for (auto& b : buckets) {
+            b = nullptr;
+        }
+        chain_ = SingleChain {};
+        size_ = 0U;
+        lastItem = &chain_.getFrontNode();
+        frontBucketIx = 0U;
+    }
+
     void reset() noexcept {
         chain_ = SingleChain {};
         size_ = 0;
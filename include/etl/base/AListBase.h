@@ -163,6 +163,13 @@ class AListBase {
                 AListBase& other,
                 Iterator first,
                 Iterator last) noexcept;
+
+    /// Splice with the number of nodes in `[first, last)` known by the caller.
+    void splice(Iterator pos,
+                AListBase& other,
+                Iterator first,
+                Iterator last,
+                size_type num) noexcept;
     /// \}
 };
 
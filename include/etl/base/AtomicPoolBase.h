@@ -0,0 +1,117 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_ATOMICPOOLBASE_H_
+#define ETL_ATOMICPOOLBASE_H_
+
+#include <etl/base/PoolStats.h>
+#include <etl/base/Proxy.h>
+#include <etl/etlSupport.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace ETL_NAMESPACE {
+namespace Detail {
+
+/**
+Lock-free pool core.
+Released items are kept on a Treiber stack of indices. The head carries
+an update counter in its upper half to avoid ABA, while the links are stored
+in a separate atomic array so the item memory is never touched by the pool.
+Never used items are taken by an atomic bump index.
+*/
+class AtomicPoolBase {
+
+  public:  // types
+
+    using Link = std::uint32_t;
+
+  private:  // types
+
+    static constexpr std::uint64_t LINK_MASK {0xFFFFFFFFU};
+    static constexpr std::uint64_t TAG_INC {LINK_MASK + 1U};
+
+  private:  // variables
+
+    Detail::Proxy data;
+    std::atomic<Link>* links;
+
+    std::atomic<std::uint64_t> head;
+    std::atomic<std::size_t> nextFreeIx;
+    std::atomic<std::size_t> freeCnt;
+
+#if ETL_POOL_STATS
+    std::atomic<std::size_t> highWater {0U};
+    std::atomic<std::size_t> failures {0U};
+    std::atomic<std::size_t> allocations {0U};
+    std::atomic<std::size_t> frees {0U};
+#endif
+
+  public:  // functions
+
+    AtomicPoolBase(const Detail::Proxy& d, std::atomic<Link>* l) noexcept :
+        data {d},
+        links {l},
+        head {0U},
+        nextFreeIx {0U},
+        freeCnt {data.size()} {}
+
+    AtomicPoolBase() = delete;
+    AtomicPoolBase(const AtomicPoolBase& other) = delete;
+    AtomicPoolBase& operator=(const AtomicPoolBase& other) = delete;
+    AtomicPoolBase(AtomicPoolBase&& other) = delete;
+    AtomicPoolBase& operator=(AtomicPoolBase&& other) = delete;
+
+    /// Takes an item, returns `nullptr` when the pool is exhausted.
+    /// \note Under contention `nullptr` may be returned while an item is
+    /// being released concurrently.
+    void* pop() noexcept;
+    bool push(void* item) noexcept;
+
+    /// Releases all items at once.
+    /// \note Not safe against concurrent `pop()` or `push()`, items still in use are invalidated.
+    void reset() noexcept;
+
+    std::size_t getFreeCount() const noexcept {
+        return freeCnt.load(std::memory_order_relaxed);
+    }
+
+    bool isLockFree() const noexcept {
+        return head.is_lock_free();
+    }
+
+    PoolStats getStats() const noexcept;
+
+  private:
+
+    void* popReleased() noexcept;
+
+#if ETL_POOL_STATS
+    void countPop(bool success) noexcept;
+#endif
+};
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_ATOMICPOOLBASE_H_
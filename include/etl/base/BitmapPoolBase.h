@@ -0,0 +1,151 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_BITMAPPOOLBASE_H_
+#define ETL_BITMAPPOOLBASE_H_
+
+#include <etl/base/PoolStats.h>
+#include <etl/base/Proxy.h>
+#include <etl/etlSupport.h>
+
+#include <cstdint>
+
+namespace ETL_NAMESPACE {
+namespace Detail {
+
+/**
+Fixed pool core tracking the used items in a bitmap.
+The lowest free item is always taken, so the used items stay packed to the start
+of the region. Free and used items are searched word by word, skipping full or
+empty words at once.
+*/
+class BitmapPoolBase {
+
+  public:  // types
+
+    using Word = std::uint64_t;
+
+  public:  // constants
+
+    static constexpr std::size_t WORD_BITS {64U};
+
+  private:  // variables
+
+    Detail::Proxy data;
+    Word* bitmap;
+
+    std::size_t freeCnt;
+    std::size_t firstFreeWord;  // All the words before are full
+
+#if ETL_POOL_STATS
+    PoolStats stats {};
+#endif
+
+  public:  // functions
+
+    /// \param d the item storage
+    /// \param b zero-initialized bitmap of `wordCount(d.size())` words
+    BitmapPoolBase(const Detail::Proxy& d, Word* b) noexcept :
+        data {d},
+        bitmap {b},
+        freeCnt {data.size()},
+        firstFreeWord {0U} {}
+
+    BitmapPoolBase() = delete;
+    BitmapPoolBase(const BitmapPoolBase& other) = delete;
+    BitmapPoolBase& operator=(const BitmapPoolBase& other) = delete;
+    BitmapPoolBase(BitmapPoolBase&& other) = delete;
+    BitmapPoolBase& operator=(BitmapPoolBase&& other) = delete;
+
+    static constexpr std::size_t wordCount(std::size_t n) noexcept {
+        return (n + WORD_BITS - 1U) / WORD_BITS;
+    }
+
+    /// Takes the lowest free item, returns `nullptr` when the pool is exhausted.
+    void* pop() noexcept;
+
+    /// Takes the lowest run of `n` contiguous free items.
+    void* pop(std::size_t n) noexcept;
+
+    bool push(void* item) noexcept {
+        return push(item, 1U);
+    }
+
+    /// Releases a run of `n` items, fails when any of them is not in use.
+    bool push(void* item, std::size_t n) noexcept;
+
+    /// Releases all items at once.
+    /// \note Items still in use are invalidated.
+    void reset() noexcept;
+
+    /// Returns the index of the first used item from `ix`, or `size()` when none.
+    std::size_t findUsed(std::size_t ix) const noexcept {
+        return find(ix, 0U);
+    }
+
+    /// Returns the index of the first free item from `ix`, or `size()` when none.
+    std::size_t findFree(std::size_t ix) const noexcept {
+        return find(ix, ~Word {0U});
+    }
+
+    bool isUsed(std::size_t ix) const noexcept {
+        return (ix < data.size())
+               && ((bitmap[ix / WORD_BITS] & (Word {1U} << (ix % WORD_BITS))) != 0U);
+    }
+
+    void* getItemPointer(std::size_t ix) noexcept {
+        return data.getItemPointer(ix);
+    }
+
+    std::size_t size() const noexcept {
+        return data.size();
+    }
+
+    std::size_t getFreeCount() const noexcept {
+        return freeCnt;
+    }
+
+    PoolStats getStats() const noexcept {
+#if ETL_POOL_STATS
+        return stats;
+#else
+        return PoolStats {};
+#endif
+    }
+
+  private:
+
+    /// Finds the first bit from `ix` differing from the bits of `skip`.
+    std::size_t find(std::size_t ix, Word skip) const noexcept;
+
+    void mark(std::size_t ix, std::size_t n, bool used) noexcept;
+
+    /// Returns the index of a run start, or `size()` if `item` is not a run of `n` used items.
+    std::size_t usedRunIndex(void* item, std::size_t n) const noexcept;
+
+    void countPop(void* result, std::size_t n) noexcept;
+};
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_BITMAPPOOLBASE_H_
@@ -0,0 +1,816 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_DEQUETEMPLATE_H_
+#define ETL_DEQUETEMPLATE_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/VectorTemplate.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+
+namespace Detail {
+
+constexpr std::size_t log2Of(std::size_t n) {
+    return (n <= 1U) ? 0U : (1U + log2Of(n / 2U));
+}
+
+}  // namespace Detail
+
+
+/**
+Double-ended queue storing its elements in fixed-size blocks.
+The blocks are allocated one by one via an AAllocator and are indexed by a block map.
+Elements are never relocated by push or pop operations at either end, so references
+and pointers to existing elements stay valid until the element is removed.
+Emptied blocks are kept for reuse at the other end until `shrink_to_fit()`.
+The block map is used as a ring, so blocks are added or removed at either end
+in constant time; the map itself grows geometrically when it is full.
+\tparam T Item type
+\tparam K Number of items in one block, must be a power of two
+*/
+template<class T, std::size_t K = 16U>
+class Deque {
+
+    static_assert((K > 0U) && ((K & (K - 1U)) == 0U),
+                  "Etl::Deque<> block size must be a power of two");
+
+  public:  // types
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    using size_type = std::uint32_t;
+    using difference_type = std::ptrdiff_t;
+
+    struct Block {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type items[K];
+    };
+
+    using BlockMap = Vector<Block*>;
+    using AllocatorBase = AAllocator<Block>;
+
+    template<class V>
+    class Iterator;
+
+    using iterator = Iterator<Deque>;
+    using const_iterator = Iterator<const Deque>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::size_t BLOCK_SIZE {K};
+
+  private:  // types
+
+    static constexpr std::size_t SHIFT {Detail::log2Of(K)};
+    static constexpr std::size_t MASK {K - 1U};
+
+  private:  // variables
+
+    BlockMap& map;
+    AllocatorBase& allocator;
+    std::size_t head {0U};
+    std::size_t blockCnt {0U};
+    std::size_t frontSpares {0U};
+    size_type start {0U};
+    size_type size_ {0U};
+
+  public:  // functions
+
+    /// \name Construction, destruction, assignment
+    /// \{
+    Deque& operator=(const Deque& other) {
+        if (&other != this) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    Deque& operator=(Deque&& other) {
+        swap(other);
+        return *this;
+    }
+
+    Deque& operator=(std::initializer_list<T> initList) {
+        assign(initList);
+        return *this;
+    }
+
+    Deque(const Deque& other) = delete;
+    Deque(Deque&& other) = delete;
+    ~Deque() = default;
+
+    void assign(size_type num, const_reference value);
+
+    template<typename InputIt>
+    enable_if_t<Detail::IsInputIterator<InputIt>::value> assign(InputIt first, InputIt last);
+
+    void assign(std::initializer_list<T> initList) {
+        assign(initList.begin(), initList.end());
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return (size_ == 0U);
+    }
+
+    size_type max_size() const noexcept;
+
+    void shrink_to_fit() noexcept;
+    /// \}
+
+    /// \name Element access
+    /// \{
+    reference operator[](size_type ix) noexcept {
+        return *slot(ix);
+    }
+
+    const_reference operator[](size_type ix) const noexcept {
+        return *slot(ix);
+    }
+
+    reference front() noexcept {
+        return *slot(0U);
+    }
+
+    const_reference front() const noexcept {
+        return *slot(0U);
+    }
+
+    reference back() noexcept {
+        return *slot(size_ - 1U);
+    }
+
+    const_reference back() const noexcept {
+        return *slot(size_ - 1U);
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return iterator(*this, 0U);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(*this, 0U);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(*this, size_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(*this, size_);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    void clear() noexcept(std::is_nothrow_destructible<T>::value);
+
+    void push_back(const_reference value) {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void push_front(const_reference value) {
+        emplace_front(value);
+    }
+
+    void push_front(value_type&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+
+    template<typename... Args>
+    void emplace_front(Args&&... args);
+
+    void pop_back() noexcept(std::is_nothrow_destructible<T>::value);
+    void pop_front() noexcept(std::is_nothrow_destructible<T>::value);
+
+    void resize(size_type length);
+    void resize(size_type length, const_reference value);
+
+    void swap(Deque& other);
+    /// \}
+
+  protected:
+
+    Deque(BlockMap& m, AllocatorBase& a) noexcept :
+        map(m),
+        allocator(a) {}
+
+    /// Destroys all elements and returns all blocks to the allocator.
+    void cleanup() noexcept(std::is_nothrow_destructible<T>::value) {
+        clear();
+        releaseBlocks(0U);
+    }
+
+  private:
+
+    /// Map entry of the n-th block counted from the front block.
+    Block*& blockAt(std::size_t n) noexcept {
+        const std::size_t ix = head + n;
+        return map[(ix < map.size()) ? ix : (ix - map.size())];
+    }
+
+    Block* blockAt(std::size_t n) const noexcept {
+        const std::size_t ix = head + n;
+        return map[(ix < map.size()) ? ix : (ix - map.size())];
+    }
+
+    /// Slot at `pos` counted from the beginning of the front block.
+    pointer slotAt(std::size_t pos) noexcept {
+        return reinterpret_cast<pointer>(&blockAt(pos >> SHIFT)->items[pos & MASK]);
+    }
+
+    pointer slot(size_type ix) noexcept {
+        return slotAt(start + ix);
+    }
+
+    const_pointer slot(size_type ix) const noexcept {
+        const std::size_t pos = start + ix;
+        return reinterpret_cast<const_pointer>(&blockAt(pos >> SHIFT)->items[pos & MASK]);
+    }
+
+    /// Number of blocks holding elements.
+    std::size_t usedBlocks() const noexcept {
+        return (start + size_ + K - 1U) >> SHIFT;
+    }
+
+    /// Keeps the size within max_size(), so a free slot is available at both ends.
+    bool isBelowLimit() const noexcept {
+        return ((size_ + K) < (blockCnt * K)) || (size_ < max_size());
+    }
+
+    bool hasRoomAtBack() const noexcept {
+        return (start + size_) < ((blockCnt - frontSpares) * K);
+    }
+
+    bool addBlockAtBack();
+    bool addBlockAtFront();
+    bool growRing();
+    bool reserveBack(size_type num);
+    void releaseBlocks(std::size_t keep) noexcept;
+
+    void swapElements(Deque& other);
+
+    friend bool operator==(const Deque& lhs, const Deque& rhs) {
+        return Detail::isEqual(lhs, rhs);
+    }
+
+    friend bool operator!=(const Deque& lhs, const Deque& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const Deque& lhs, const Deque& rhs) {
+        return Detail::isLess(lhs, rhs);
+    }
+
+    friend bool operator<=(const Deque& lhs, const Deque& rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>(const Deque& lhs, const Deque& rhs) {
+        return (rhs < lhs);
+    }
+
+    friend bool operator>=(const Deque& lhs, const Deque& rhs) {
+        return !(lhs < rhs);
+    }
+
+    friend void swap(Deque& lhs, Deque& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+
+/// Random access iterator of Deque, addressing items by index.
+template<class T, std::size_t K>
+template<class V>
+class Deque<T, K>::Iterator {
+
+    friend class Deque<T, K>;
+    friend class Iterator<const Deque<T, K>>;
+
+  public:  // types
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename Detail::CopyConst<V, T>::Type*;
+    using reference = typename Detail::CopyConst<V, T>::Type&;
+
+  private:  // variables
+
+    V* cont;
+    size_type ix;
+
+  public:  // functions
+
+    Iterator() noexcept :
+        cont(nullptr),
+        ix(0U) {}
+
+    template<class U, enable_if_t<std::is_same<const U, V>::value, bool> = true>
+    Iterator(const Iterator<U>& other) noexcept :
+        cont(other.cont),
+        ix(other.ix) {}
+
+    reference operator*() const noexcept {
+        return (*cont)[ix];
+    }
+
+    pointer operator->() const noexcept {
+        return &(*cont)[ix];
+    }
+
+    reference operator[](difference_type n) const noexcept {
+        return (*cont)[ix + n];
+    }
+
+    Iterator& operator++() noexcept {
+        ++ix;
+        return *this;
+    }
+
+    Iterator& operator--() noexcept {
+        --ix;
+        return *this;
+    }
+
+    const Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++ix;
+        return old;
+    }
+
+    const Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        --ix;
+        return old;
+    }
+
+    Iterator& operator+=(difference_type n) noexcept {
+        ix += n;
+        return *this;
+    }
+
+    Iterator& operator-=(difference_type n) noexcept {
+        ix -= n;
+        return *this;
+    }
+
+    Iterator operator+(difference_type n) const noexcept {
+        return Iterator(*cont, ix + n);
+    }
+
+    Iterator operator-(difference_type n) const noexcept {
+        return Iterator(*cont, ix - n);
+    }
+
+    difference_type operator-(const Iterator& other) const noexcept {
+        return static_cast<difference_type>(ix) - static_cast<difference_type>(other.ix);
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+        return (cont == other.cont) && (ix == other.ix);
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+        return !(operator==(other));
+    }
+
+    bool operator<(const Iterator& other) const noexcept {
+        return ix < other.ix;
+    }
+
+    bool operator>(const Iterator& other) const noexcept {
+        return other < *this;
+    }
+
+    bool operator<=(const Iterator& other) const noexcept {
+        return !(other < *this);
+    }
+
+    bool operator>=(const Iterator& other) const noexcept {
+        return !(*this < other);
+    }
+
+  private:
+
+    Iterator(V& c, size_type i) noexcept :
+        cont(&c),
+        ix(i) {}
+
+    friend Iterator operator+(difference_type n, const Iterator& it) noexcept {
+        return it + n;
+    }
+};
+
+
+template<class T, std::size_t K>
+constexpr std::size_t Deque<T, K>::BLOCK_SIZE;
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::assign(size_type num, const_reference value) {
+
+    clear();
+    for (size_type i = 0U; i < num; ++i) {
+        emplace_back(value);
+    }
+}
+
+
+template<class T, std::size_t K>
+template<typename InputIt>
+auto Deque<T, K>::assign(InputIt first, InputIt last)
+    -> enable_if_t<Detail::IsInputIterator<InputIt>::value> {
+
+    clear();
+    while (first != last) {
+        emplace_back(*first);
+        ++first;
+    }
+}
+
+
+template<class T, std::size_t K>
+auto Deque<T, K>::max_size() const noexcept -> size_type {
+
+    // One block is reserved for the offset of the front element.
+    std::size_t numOfBlocks = std::min(map.max_size(), allocator.max_size());
+    std::size_t limit = std::numeric_limits<size_type>::max() / K;
+
+    numOfBlocks = std::min(numOfBlocks, limit);
+    return static_cast<size_type>((numOfBlocks > 0U) ? ((numOfBlocks - 1U) * K) : 0U);
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::shrink_to_fit() noexcept {
+
+    releaseBlocks(usedBlocks());
+    if (blockCnt == 0U) {
+        start = 0U;
+    }
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::clear() noexcept(std::is_nothrow_destructible<T>::value) {
+
+    while (size_ > 0U) {
+        pop_back();
+    }
+}
+
+
+template<class T, std::size_t K>
+template<typename... Args>
+void Deque<T, K>::emplace_back(Args&&... args) {
+
+    if (isBelowLimit() && (hasRoomAtBack() || addBlockAtBack())) {
+        new (slot(size_)) T(std::forward<Args>(args)...);
+        ++size_;
+    }
+}
+
+
+template<class T, std::size_t K>
+template<typename... Args>
+void Deque<T, K>::emplace_front(Args&&... args) {
+
+    if (isBelowLimit() && ((start > 0U) || addBlockAtFront())) {
+        new (slotAt(start - 1U)) T(std::forward<Args>(args)...);
+        --start;
+        ++size_;
+    }
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::pop_back() noexcept(std::is_nothrow_destructible<T>::value) {
+
+    ETL_ASSERT(size_ > 0U);
+
+    --size_;
+    slot(size_)->~T();
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::pop_front() noexcept(std::is_nothrow_destructible<T>::value) {
+
+    ETL_ASSERT(size_ > 0U);
+
+    slot(0U)->~T();
+    ++start;
+    --size_;
+
+    if (start == K) {
+        // Keep the emptied front block as a spare in front of the ring head.
+        head = (head + 1U < map.size()) ? (head + 1U) : 0U;
+        ++frontSpares;
+        start = 0U;
+    }
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::resize(size_type length) {
+
+    while (size_ > length) {
+        pop_back();
+    }
+
+    while (size_ < length) {
+        const size_type origSize = size_;
+        emplace_back();
+        if (size_ == origSize) {
+            break;
+        }
+    }
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::resize(size_type length, const_reference value) {
+
+    while (size_ > length) {
+        pop_back();
+    }
+
+    while (size_ < length) {
+        const size_type origSize = size_;
+        emplace_back(value);
+        if (size_ == origSize) {
+            break;
+        }
+    }
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::swap(Deque& other) {
+
+    if (&other == this) {
+        return;
+    }
+
+    bool sameAllocator = (allocator.handle() == other.allocator.handle());
+    bool mapsFit = (map.max_size() >= other.map.size()) && (other.map.max_size() >= map.size());
+
+    if (sameAllocator && mapsFit) {
+        map.swap(other.map);
+        std::swap(head, other.head);
+        std::swap(blockCnt, other.blockCnt);
+        std::swap(frontSpares, other.frontSpares);
+        std::swap(start, other.start);
+        std::swap(size_, other.size_);
+    } else {
+        swapElements(other);
+    }
+}
+
+
+template<class T, std::size_t K>
+bool Deque<T, K>::addBlockAtBack() {
+
+    const std::size_t backEnd = blockCnt - frontSpares;
+
+    if (frontSpares > 0U) {
+        // Move the farthest spare block from the front to the back.
+        const std::size_t farthest = map.size() - frontSpares;
+        if (farthest != backEnd) {
+            blockAt(backEnd) = blockAt(farthest);
+            blockAt(farthest) = nullptr;
+        }
+
+        --frontSpares;
+        return true;
+    }
+
+    if ((blockCnt == map.size()) && !growRing()) {
+        return false;
+    }
+
+    Block* block = allocator.allocate(1U);
+    if (block == nullptr) {
+        return false;
+    }
+
+    blockAt(backEnd) = block;
+    ++blockCnt;
+    return true;
+}
+
+
+template<class T, std::size_t K>
+bool Deque<T, K>::addBlockAtFront() {
+
+    if (frontSpares == 0U) {
+
+        if (blockCnt > usedBlocks()) {
+            // Move the farthest spare block from the back to the front.
+            const std::size_t farthest = blockCnt - 1U;
+            if (farthest != (map.size() - 1U)) {
+                blockAt(map.size() - 1U) = blockAt(farthest);
+                blockAt(farthest) = nullptr;
+            }
+        } else {
+            if ((blockCnt == map.size()) && !growRing()) {
+                return false;
+            }
+
+            Block* block = allocator.allocate(1U);
+            if (block == nullptr) {
+                return false;
+            }
+
+            blockAt(map.size() - 1U) = block;
+            ++blockCnt;
+        }
+
+        ++frontSpares;
+    }
+
+    head = (head > 0U) ? (head - 1U) : (map.size() - 1U);
+    --frontSpares;
+    start += K;
+    return true;
+}
+
+
+template<class T, std::size_t K>
+bool Deque<T, K>::growRing() {
+
+    // Empty slots are inserted between the last and the first block of the ring.
+    const std::size_t ringSize = map.size();
+    const std::size_t num = std::min(std::max(ringSize, std::size_t {1U}), map.max_size() - ringSize);
+    if (num == 0U) {
+        return false;
+    }
+
+    map.insert(map.begin() + head, num, nullptr);
+    if (map.size() != (ringSize + num)) {
+        return false;
+    }
+
+    if (ringSize > 0U) {
+        head += num;
+    }
+
+    return true;
+}
+
+
+template<class T, std::size_t K>
+bool Deque<T, K>::reserveBack(size_type num) {
+
+    if (num > (max_size() - size_)) {
+        return false;
+    }
+
+    while ((start + size_ + num) > ((blockCnt - frontSpares) * K)) {
+        if (!addBlockAtBack()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::releaseBlocks(std::size_t keep) noexcept {
+
+    while (frontSpares > 0U) {
+        Block*& block = blockAt(map.size() - frontSpares);
+        allocator.deallocate(block, 1U);
+        block = nullptr;
+        --frontSpares;
+        --blockCnt;
+    }
+
+    while (blockCnt > keep) {
+        --blockCnt;
+        Block*& block = blockAt(blockCnt);
+        allocator.deallocate(block, 1U);
+        block = nullptr;
+    }
+
+    if (blockCnt == 0U) {
+        map.clear();
+        head = 0U;
+    }
+}
+
+
+template<class T, std::size_t K>
+void Deque<T, K>::swapElements(Deque& other) {
+
+    Deque& longer = (size_ >= other.size_) ? *this : other;
+    Deque& shorter = (size_ >= other.size_) ? other : *this;
+
+    const size_type common = shorter.size_;
+    const size_type longerSize = longer.size_;
+
+    // Acquire every block needed before touching the elements.
+    if (!shorter.reserveBack(longerSize - common)) {
+        return;
+    }
+
+    using std::swap;
+    for (size_type i = 0U; i < common; ++i) {
+        swap(longer[i], shorter[i]);
+    }
+
+    for (size_type i = common; i < longerSize; ++i) {
+        shorter.emplace_back(std::move(longer[i]));
+    }
+
+    while (longer.size_ > common) {
+        longer.pop_back();
+    }
+}
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_DEQUETEMPLATE_H_
@@ -93,6 +93,18 @@ class DoubleChain {
 
     Node* remove(Node* node) noexcept;
     void replace(Node* n1, Node* n2) noexcept;
+
+    /// Relinks the nodes of `[first, last)` before `pos`, in constant time.
+    /// The range may belong to another chain, `pos` must not be inside the range.
+    void splice(Node* pos, Node* first, Node* last) noexcept;
+
+    /// Detaches all nodes, returning them as a `nullptr` terminated list linked by `next`.
+    Node* detach() noexcept;
+
+    /// Appends a `nullptr` terminated list linked by `next`, restoring the `prev` links.
+    void attach(Node* first) noexcept;
+
+    void reverse() noexcept;
     void setEmpty() noexcept;
 
     void swap(DoubleChain& other) noexcept;
@@ -25,6 +25,8 @@ limitations under the License.
 #include <etl/FifoAccess.h>
 #include <etl/etlSupport.h>
 
+#include <utility>
+
 namespace ETL_NAMESPACE {
 
 
@@ -48,9 +50,9 @@ class FifoTemplate : public FifoAccess<typename C::value_type> {
   public:  // functions
 
     template<typename... Args>
-    explicit FifoTemplate<C>(Args... args) :
+    explicit FifoTemplate<C>(Args&&... args) :
         Base(),
-        cont(args...) {
+        cont(std::forward<Args>(args)...) {
         Base::setupFor(cont);
     }
 
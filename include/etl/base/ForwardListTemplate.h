@@ -0,0 +1,602 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_FORWARDLISTTEMPLATE_H_
+#define ETL_FORWARDLISTTEMPLATE_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/SingleChain.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+
+/**
+Singly linked list template with custom allocator.
+Nodes carry a single link, the list supports forward iteration only.
+\tparam T Element type
+*/
+template<class T>
+class ForwardList {
+
+  public:  // types
+
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    using size_type = std::uint32_t;
+
+    class Node : public Detail::SingleChain::Node {
+
+      public:  // variables
+
+        T item;
+
+      public:  // functions
+
+        template<typename... Args>
+        explicit Node(Args&&... args) :
+            item(std::forward<Args>(args)...) {}
+
+        Node& operator=(const Node& other) = delete;
+        Node& operator=(Node&& other) = delete;
+        ~Node() = default;
+    };
+
+    template<class V>
+    class Iterator;
+
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    using AllocatorBase = AAllocator<Node>;
+
+  private:  // variables
+
+    Detail::SingleChain chain;
+    AllocatorBase& allocator;
+    size_type size_ {0U};
+
+  public:  // functions
+
+    /// \name Construction, destruction, assignment
+    /// \{
+
+    explicit ForwardList(AllocatorBase& a) noexcept :
+        allocator {a} {}
+
+    ForwardList& operator=(const ForwardList& other) {
+        if (&other != this) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    ForwardList& operator=(ForwardList&& other) {
+        swap(other);
+        return *this;
+    }
+
+    ForwardList& operator=(std::initializer_list<T> initList) {
+        assign(initList);
+        return *this;
+    }
+
+    ForwardList(const ForwardList& other) = delete;
+    ForwardList(ForwardList&& other) = delete;
+
+    ~ForwardList() noexcept(AllocatorBase::noexceptDestroy) {
+        clear();
+    }
+
+    void assign(size_type num, const_reference value) {
+        clear();
+        insert_after(before_begin(), num, value);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        insert_after(before_begin(), first, last);
+    }
+
+    void assign(std::initializer_list<T> initList) {
+        assign(initList.begin(), initList.end());
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return chain.isEmpty();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type max_size() const noexcept {
+        return allocator.max_size();
+    }
+    /// \}
+
+    /// \name Element access
+    /// \{
+    reference front() noexcept {
+        ETL_ASSERT(!empty());
+        return static_cast<Node*>(chain.getFirst())->item;
+    }
+
+    const_reference front() const noexcept {
+        ETL_ASSERT(!empty());
+        return static_cast<const Node*>(chain.getFirst())->item;
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator before_begin() noexcept {
+        return iterator(&chain.getFrontNode());
+    }
+
+    const_iterator before_begin() const noexcept {
+        return const_iterator(const_cast<Detail::SingleChain::Node*>(&chain.getFrontNode()));
+    }
+
+    const_iterator cbefore_begin() const noexcept {
+        return before_begin();
+    }
+
+    iterator begin() noexcept {
+        return iterator(chain.getFirst());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(chain.getFirst());
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(nullptr);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    void clear() noexcept(AllocatorBase::noexceptDestroy);
+
+    void push_front(const T& item) {
+        emplace_after(before_begin(), item);
+    }
+
+    void push_front(T&& item) {
+        emplace_after(before_begin(), std::move(item));
+    }
+
+    template<typename... Args>
+    iterator emplace_front(Args&&... args) {
+        return emplace_after(before_begin(), std::forward<Args>(args)...);
+    }
+
+    void pop_front() noexcept(AllocatorBase::noexceptDestroy) {
+        erase_after(before_begin());
+    }
+
+    iterator insert_after(const_iterator pos, const T& item) {
+        return emplace_after(pos, item);
+    }
+
+    iterator insert_after(const_iterator pos, T&& item) {
+        return emplace_after(pos, std::move(item));
+    }
+
+    iterator insert_after(const_iterator pos, size_type n, const T& item);
+
+    template<typename InputIt>
+    enable_if_t<Detail::IsInputIterator<InputIt>::value, iterator>
+    insert_after(const_iterator pos, InputIt first, InputIt last);
+
+    iterator insert_after(const_iterator pos, std::initializer_list<T> initList) {
+        return insert_after(pos, initList.begin(), initList.end());
+    }
+
+    /// Constructs an element after `pos`, returns `end()` when the allocation fails.
+    template<typename... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args);
+
+    iterator erase_after(const_iterator pos) noexcept(AllocatorBase::noexceptDestroy) {
+        ETL_ASSERT(pos.node != nullptr);
+        ETL_ASSERT(pos.node->next != nullptr);
+        deleteNode(static_cast<Node*>(chain.removeAfter(pos.node)));
+        --size_;
+        return iterator(pos.node->next);
+    }
+
+    /// Erases the elements in `(first, last)`.
+    iterator erase_after(const_iterator first,
+                         const_iterator last) noexcept(AllocatorBase::noexceptDestroy) {
+        while (first.node->next != last.node) {
+            erase_after(first);
+        }
+        return iterator(last.node);
+    }
+
+    template<class P>
+    size_type remove_if(P pred) noexcept(AllocatorBase::noexceptDestroy
+                                         && noexcept(pred(std::declval<reference>())));
+
+    void swap(ForwardList& other);
+    /// \}
+
+    /// \name List operations
+    /// \{
+    void splice_after(const_iterator pos, ForwardList& other) {
+        splice_after(pos, other, other.before_begin(), other.end());
+    }
+
+    /// Moves the element following `it` of `other` after `pos`.
+    void splice_after(const_iterator pos, ForwardList& other, const_iterator it) {
+        const_iterator last = it;
+        ++last;
+        ETL_ASSERT(last != other.end());
+        ++last;
+        splice_after(pos, other, it, last);
+    }
+
+    /// Moves the elements in `(first, last)` of `other` after `pos`.
+    /// Nodes are relinked when the allocators match, elements are moved otherwise.
+    void splice_after(const_iterator pos,
+                      ForwardList& other,
+                      const_iterator first,
+                      const_iterator last);
+
+    /// Reverses the order of the elements by relinking the nodes.
+    void reverse() noexcept {
+        chain.reverse();
+    }
+    /// \}
+
+  protected:
+
+    void swapNodeList(ForwardList& other) noexcept {
+        chain.swap(other.chain);
+        std::swap(size_, other.size_);
+    }
+
+    /// Unlinks all nodes without destroying or deallocating them,
+    /// for derived classes releasing their own allocator as a whole.
+    void dropNodes() noexcept {
+        chain = Detail::SingleChain {};
+        size_ = 0U;
+    }
+
+  private:
+
+    void deleteNode(Node* ptr) noexcept(AllocatorBase::noexceptDestroy) {
+        if (ptr != nullptr) {
+            allocator.destroy(ptr);
+            allocator.deallocate(ptr, 1U);
+        }
+    }
+
+    void swapElements(ForwardList& other);
+
+    void moveElementsAfter(const_iterator pos,
+                           ForwardList& other,
+                           const_iterator first,
+                           const_iterator last);
+};
+
+
+template<class T>
+template<class V>
+class ForwardList<T>::Iterator {
+
+    friend class ForwardList<T>;
+    friend class Iterator<T>;
+    friend class Iterator<const T>;
+
+  public:  // types
+
+    using difference_type = int;
+    using value_type = T;
+    using pointer = V*;
+    using reference = V&;
+    using iterator_category = std::forward_iterator_tag;
+
+  private:  // variables
+
+    Detail::SingleChain::Node* node;
+
+  public:  // functions
+
+    Iterator() noexcept :
+        node(nullptr) {}
+
+    template<class U, enable_if_t<std::is_same<const U, V>::value, bool> = true>
+    Iterator(const Iterator<U>& other) noexcept :
+        node(other.node) {}
+
+    reference operator*() const noexcept {
+        return static_cast<Node*>(node)->item;
+    }
+
+    pointer operator->() const noexcept {
+        return &(static_cast<Node*>(node)->item);
+    }
+
+    template<class U>
+    bool operator==(const Iterator<U>& other) const noexcept {
+        return (node == other.node);
+    }
+
+    template<class U>
+    bool operator!=(const Iterator<U>& other) const noexcept {
+        return !(operator==(other));
+    }
+
+    Iterator& operator++() noexcept {
+        node = node->next;
+        return *this;
+    }
+
+    const Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        operator++();
+        return old;
+    }
+
+  private:
+
+    explicit Iterator(Detail::SingleChain::Node* n) noexcept :
+        node(n) {}
+};
+
+
+template<class T>
+void ForwardList<T>::clear() noexcept(AllocatorBase::noexceptDestroy) {
+
+    while (!chain.isEmpty()) {
+        deleteNode(static_cast<Node*>(chain.removeAfter(&chain.getFrontNode())));
+    }
+
+    size_ = 0U;
+}
+
+
+template<class T>
+auto ForwardList<T>::insert_after(const_iterator pos, size_type n, const T& item) -> iterator {
+
+    iterator it(pos.node);
+    while (n > 0U) {
+        it = insert_after(it, item);
+        --n;
+    }
+
+    return it;
+}
+
+
+template<class T>
+template<typename InputIt>
+enable_if_t<Detail::IsInputIterator<InputIt>::value, typename ForwardList<T>::iterator>
+ForwardList<T>::insert_after(const_iterator pos, InputIt first, InputIt last) {
+
+    iterator it(pos.node);
+    while ((first != last) && (it != end())) {
+        it = insert_after(it, *first);
+        ++first;
+    }
+
+    return it;
+}
+
+
+template<class T>
+template<typename... Args>
+auto ForwardList<T>::emplace_after(const_iterator pos, Args&&... args) -> iterator {
+
+    ETL_ASSERT(pos.node != nullptr);
+
+    iterator it = end();
+    Node* inserted = allocator.allocate(1U);
+    if (inserted != nullptr) {
+        new (inserted) Node(std::forward<Args>(args)...);
+        chain.insertAfter(pos.node, inserted);
+        ++size_;
+        it = iterator(inserted);
+    }
+
+    return it;
+}
+
+
+template<class T>
+template<class P>
+auto ForwardList<T>::remove_if(P pred) noexcept(AllocatorBase::noexceptDestroy
+                                                && noexcept(pred(std::declval<reference>())))
+    -> size_type {
+
+    size_type cnt = 0U;
+    const_iterator prev = before_begin();
+    while (prev.node->next != nullptr) {
+        if (pred(static_cast<Node*>(prev.node->next)->item)) {
+            erase_after(prev);
+            ++cnt;
+        } else {
+            ++prev;
+        }
+    }
+
+    return cnt;
+}
+
+
+template<class T>
+void ForwardList<T>::swap(ForwardList& other) {
+
+    if (&other != this) {
+        if (allocator.handle() == other.allocator.handle()) {
+            swapNodeList(other);
+        } else {
+            swapElements(other);
+        }
+    }
+}
+
+
+template<class T>
+void ForwardList<T>::swapElements(ForwardList& other) {
+
+    iterator ownPrev = before_begin();
+    iterator otherPrev = other.before_begin();
+
+    while ((ownPrev.node->next != nullptr) && (otherPrev.node->next != nullptr)) {
+        ++ownPrev;
+        ++otherPrev;
+        Detail::swapInCont(*ownPrev, *otherPrev);
+    }
+
+    if (ownPrev.node->next != nullptr) {
+        other.moveElementsAfter(otherPrev, *this, ownPrev, end());
+    } else if (otherPrev.node->next != nullptr) {
+        moveElementsAfter(ownPrev, other, otherPrev, other.end());
+    }
+}
+
+
+template<class T>
+void ForwardList<T>::splice_after(const_iterator pos,
+                                  ForwardList& other,
+                                  const_iterator first,
+                                  const_iterator last) {
+
+    if ((first.node->next == last.node) || (pos == first)) {
+        return;
+    }
+
+    if (allocator.handle() == other.allocator.handle()) {
+
+        size_type num = 1U;
+        auto* back = first.node->next;
+        while (back->next != last.node) {
+            back = back->next;
+            ++num;
+        }
+
+        Detail::SingleChain::spliceAfter(pos.node, first.node, back);
+        size_ += num;
+        other.size_ -= num;
+
+    } else {
+        moveElementsAfter(pos, other, first, last);
+    }
+}
+
+
+template<class T>
+void ForwardList<T>::moveElementsAfter(const_iterator pos,
+                                       ForwardList& other,
+                                       const_iterator first,
+                                       const_iterator last) {
+
+    ETL_ASSERT(&other != this);
+
+    while (first.node->next != last.node) {
+        auto& item = static_cast<Node*>(first.node->next)->item;
+        auto inserted = insert_after(pos, std::move(item));
+        if (inserted == end()) {
+            break;
+        }
+        pos = inserted;
+        other.erase_after(first);
+    }
+}
+
+
+template<class T>
+bool operator==(const ForwardList<T>& lhs, const ForwardList<T>& rhs) {
+    return Detail::isEqual(lhs, rhs);
+}
+
+template<class T>
+bool operator!=(const ForwardList<T>& lhs, const ForwardList<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+template<class T>
+bool operator<(const ForwardList<T>& lhs, const ForwardList<T>& rhs) {
+    return Detail::isLess(lhs, rhs);
+}
+
+template<class T>
+bool operator<=(const ForwardList<T>& lhs, const ForwardList<T>& rhs) {
+    return !(rhs < lhs);
+}
+
+template<class T>
+bool operator>(const ForwardList<T>& lhs, const ForwardList<T>& rhs) {
+    return (rhs < lhs);
+}
+
+template<class T>
+bool operator>=(const ForwardList<T>& lhs, const ForwardList<T>& rhs) {
+    return !(lhs < rhs);
+}
+
+
+template<class T>
+void swap(ForwardList<T>& lhs, ForwardList<T>& rhs) {
+    lhs.swap(rhs);
+}
+
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class T, class P>
+typename ForwardList<T>::size_type erase_if(ForwardList<T>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_FORWARDLISTTEMPLATE_H_
@@ -0,0 +1,117 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_INTRUSIVETOOLS_H_
+#define ETL_INTRUSIVETOOLS_H_
+
+#include <etl/etlSupport.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+namespace Intrusive {
+
+/**
+Offset of the hook member `H` in `T`.
+The default derives the offset from the member pointer once, which needs `T`
+to be standard layout. It can be specialized to provide the offset directly:
+\code
+namespace Etl {
+namespace Intrusive {
+template<>
+struct HookOffset<Item, ListHook, &Item::hook> {
+    static std::size_t value() noexcept {
+        return offsetof(Item, hook);
+    }
+};
+}
+}
+\endcode
+\tparam T Owner type
+\tparam K Hook type
+\tparam H Pointer to the hook member of `T`
+*/
+template<class T, class K, K T::*H>
+struct HookOffset {
+
+    static_assert(std::is_standard_layout<T>::value,
+                  "The hook offset of non standard layout types needs a HookOffset<> "
+                  "specialization");
+
+    static std::size_t value() noexcept {
+        static const std::size_t off = probe();
+        return off;
+    }
+
+  private:
+
+    static std::size_t probe() noexcept {
+        // Only addresses are used, the probe is never read
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        const T* owner = reinterpret_cast<const T*>(&storage);
+        const auto* hook = reinterpret_cast<const char*>(&(owner->*H));
+        return static_cast<std::size_t>(hook - reinterpret_cast<const char*>(owner));
+    }
+};
+
+}  // namespace Intrusive
+
+
+namespace Detail {
+
+/**
+Maps a hook member back to the object owning it.
+\tparam T Owner type
+\tparam K Hook type
+\tparam H Pointer to the hook member of `T`
+*/
+template<class T, class K, K T::*H>
+struct HookMember {
+
+    static std::size_t offset() noexcept {
+        return Intrusive::HookOffset<T, K, H>::value();
+    }
+
+    static K& hookOf(T& item) noexcept {
+        return item.*H;
+    }
+
+    static T& ownerOf(K& hook) noexcept {
+        return *reinterpret_cast<T*>(reinterpret_cast<char*>(&hook) - offset());
+    }
+
+    static const T& ownerOf(const K& hook) noexcept {
+        return *reinterpret_cast<const T*>(reinterpret_cast<const char*>(&hook) - offset());
+    }
+};
+
+
+/// Key type returned by the key function `KF` for `T`.
+template<class T, class KF>
+using KeyOf = typename std::decay<decltype(std::declval<const KF&>()(std::declval<const T&>()))>::type;
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_INTRUSIVETOOLS_H_
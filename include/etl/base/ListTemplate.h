@@ -29,7 +29,9 @@ limitations under the License.
 #include <etl/traitSupport.h>
 
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 
 namespace ETL_NAMESPACE {
 
@@ -143,7 +145,9 @@ class List : private Detail::TypedListBase<T> {
     void clear() noexcept(AllocatorBase::noexceptDestroy);
 
     void push_front(const T& item);
+    void push_front(T&& item);
     void push_back(const T& item);
+    void push_back(T&& item);
 
     void pop_front() noexcept(AllocatorBase::noexceptDestroy) {
         deleteNode(static_cast<Node*>(Detail::AListBase::popFront()));
@@ -160,12 +164,7 @@ class List : private Detail::TypedListBase<T> {
     }
 
     iterator insert(const_iterator pos, size_type n, const T& item) {
-        iterator it = this->end();
-        while (n > 0) {
-            it = insert(pos, item);
-            --n;
-        }
-        return it;
+        return insertNodes(pos, n, [&item](Node* p) { new (p) Node(item); });
     }
 
     template<typename InputIt>
@@ -196,6 +195,10 @@ class List : private Detail::TypedListBase<T> {
         return next;
     }
 
+    template<class P>
+    size_type remove_if(P pred) noexcept(AllocatorBase::noexceptDestroy
+                                         && noexcept(pred(std::declval<reference>())));
+
     void swap(List& other) {
         if (this != &other) {
             if (allocator.handle() == other.allocator.handle()) {
@@ -217,14 +220,54 @@ class List : private Detail::TypedListBase<T> {
     void splice(const_iterator pos, List& other, const_iterator it) {
         const_iterator it2 = it;
         ++it2;
-        splice(pos, other, it, it2);
+        splice(pos, other, it, it2, 1U);
     }
 
+    /// Moves `[first, last)` of `other` before `pos`.
+    /// Nodes are relinked when the allocators match, this costs counting
+    /// the range unless it's the whole `other`.
     void splice(const_iterator pos,
                 List& other,
                 const_iterator first,
                 const_iterator last);
 
+    /// Moves `[first, last)` of `other` before `pos`, where `num` is the length of the range.
+    /// Constant time when the allocators match.
+    void splice(const_iterator pos,
+                List& other,
+                const_iterator first,
+                const_iterator last,
+                size_type num);
+
+    /// Merges the sorted `other` into this sorted list, stable.
+    /// Nodes are relinked when the allocators match, elements are moved otherwise.
+    void merge(List& other) {
+        merge(other, std::less<T>());
+    }
+
+    template<class C>
+    void merge(List& other, C comp);
+
+    /// Sorts the list by relinking the nodes, stable, without allocation.
+    void sort() {
+        sort(std::less<T>());
+    }
+
+    template<class C>
+    void sort(C comp);
+
+    /// Removes consecutive equal elements, returns the number of removed elements.
+    size_type unique() {
+        return unique(std::equal_to<T>());
+    }
+
+    template<class P>
+    size_type unique(P pred);
+
+    void reverse() noexcept {
+        this->chain.reverse();
+    }
+
     /// \}
 
   protected:
@@ -234,8 +277,67 @@ class List : private Detail::TypedListBase<T> {
         Detail::AListBase::swapNodeList(other);
     }
 
+    /// Unlinks all nodes without destroying or deallocating them,
+    /// for derived classes releasing their own allocator as a whole.
+    void dropNodes() noexcept {
+        this->chain.detach();
+        this->size_ = 0U;
+    }
+
   private:
 
+    /// Number of nodes allocated or released with one bulk allocator call.
+    static constexpr size_type BULK_SIZE {16U};
+
+    /// Collects destroyed nodes and returns them to the allocator in bulks.
+    class ReleaseBatch {
+
+        AllocatorBase& allocator;
+        Node* nodes[BULK_SIZE];
+        size_type cnt;
+
+      public:
+
+        explicit ReleaseBatch(AllocatorBase& a) noexcept :
+            allocator(a),
+            cnt(0U) {}
+
+        ReleaseBatch(const ReleaseBatch& other) = delete;
+        ReleaseBatch& operator=(const ReleaseBatch& other) = delete;
+
+        ~ReleaseBatch() {
+            flush();
+        }
+
+        void add(Node* node) noexcept(AllocatorBase::noexceptDestroy) {
+            allocator.destroy(node);
+            nodes[cnt] = node;
+            ++cnt;
+            if (cnt == BULK_SIZE) {
+                flush();
+            }
+        }
+
+        void flush() noexcept {
+            if (cnt > 0U) {
+                allocator.deallocate_bulk(nodes, cnt);
+                cnt = 0U;
+            }
+        }
+    };
+
+    /// Inserts `n` nodes before `pos` allocated in bulks, `make` constructs the nodes.
+    /// \return iterator to the first inserted element, or `pos` if none inserted.
+    template<typename F>
+    iterator insertNodes(const_iterator pos, size_type n, F make);
+
+    template<typename InputIt>
+    iterator insertRange(const_iterator pos, InputIt first, InputIt last, std::input_iterator_tag);
+
+    template<typename ForwardIt>
+    iterator
+    insertRange(const_iterator pos, ForwardIt first, ForwardIt last, std::forward_iterator_tag);
+
     Node* createNode(const T& item) {
         Node* p = allocator.allocate(1);
         if (p != nullptr) {
@@ -331,15 +433,247 @@ class List : private Detail::TypedListBase<T> {
         insert(pos, std::move(*toSteal));
         return other.erase(toSteal);
     }
+
+    static const T& itemOf(const Detail::DoubleChain::Node* node) noexcept {
+        return static_cast<const Node*>(node)->item;
+    }
+
+    /// Merges two `nullptr` terminated runs linked by `next`, `a` precedes `b` on equality.
+    /// Both runs are consumed, on exception all of their nodes are left in `a`.
+    template<class C>
+    static Detail::DoubleChain::Node*
+    mergeRuns(Detail::DoubleChain::Node*& a, Detail::DoubleChain::Node*& b, C& comp);
 };
 
 
+template<class T>
+constexpr typename List<T>::size_type List<T>::BULK_SIZE;
+
+
 template<class T>
 void List<T>::clear() noexcept(AllocatorBase::noexceptDestroy) {
 
-    while (Base::size() > 0) {
-        pop_back();
+    ReleaseBatch released(allocator);
+
+    auto* node = this->chain.detach();
+    this->size_ = 0U;
+
+    while (node != nullptr) {
+        auto* next = node->next;
+        released.add(static_cast<Node*>(node));
+        node = next;
+    }
+}
+
+
+template<class T>
+template<class P>
+auto List<T>::remove_if(P pred) noexcept(AllocatorBase::noexceptDestroy
+                                         && noexcept(pred(std::declval<reference>())))
+    -> size_type {
+
+    ReleaseBatch released(allocator);
+    size_type numErased = 0U;
+
+    auto it = this->begin();
+    while (it != this->end()) {
+        if (pred(*it)) {
+            iterator next = it;
+            ++next;
+            released.add(static_cast<Node*>(Detail::AListBase::remove(it)));
+            it = next;
+            ++numErased;
+        } else {
+            ++it;
+        }
+    }
+
+    return numErased;
+}
+
+
+template<class T>
+template<class C>
+void List<T>::merge(List& other, C comp) {
+
+    if (this == &other) {
+        return;
+    }
+
+    const bool relink = (allocator.handle() == other.allocator.handle());
+
+    iterator pos = this->begin();
+    iterator item = other.begin();
+    while (item != other.end()) {
+
+        while ((pos != this->end()) && !comp(*item, *pos)) {
+            ++pos;
+        }
+
+        if (relink) {
+            // Relink the whole run of `other` belonging before `pos` at once.
+            iterator last = item;
+            ++last;
+            size_type num = 1U;
+            while ((last != other.end()) && ((pos == this->end()) || comp(*last, *pos))) {
+                ++last;
+                ++num;
+            }
+
+            Detail::AListBase::splice(pos, other, item, last, num);
+            item = last;
+
+        } else {
+            item = stealElement(pos, other, item);
+        }
+    }
+}
+
+
+template<class T>
+template<class C>
+void List<T>::sort(C comp) {
+
+    using ChainNode = Detail::DoubleChain::Node;
+
+    // Bottom-up merge sort: bins[i] holds a sorted run of 2^i nodes, or none.
+    // Higher bins hold earlier elements, so runs of higher bins are merged first
+    // to keep the sort stable.
+    static constexpr std::size_t NUM_OF_BINS {32U};
+    ChainNode* bins[NUM_OF_BINS] = {};
+    ChainNode* carry = nullptr;
+    ChainNode* rest = this->chain.detach();
+
+    // Reattaches every node in unspecified order if `comp` throws.
+    struct Unwind {
+        Detail::DoubleChain& chain;
+        ChainNode** bins;
+        ChainNode*& carry;
+        ChainNode*& rest;
+        bool active;
+
+        ~Unwind() {
+            if (active) {
+                chain.attach(carry);
+                for (std::size_t i = 0U; i < NUM_OF_BINS; ++i) {
+                    chain.attach(bins[i]);
+                }
+                chain.attach(rest);
+            }
+        }
+    } unwind {this->chain, bins, carry, rest, true};
+
+    while (rest != nullptr) {
+
+        carry = rest;
+        rest = rest->next;
+        carry->next = nullptr;
+
+        std::size_t i = 0U;
+        while ((i < (NUM_OF_BINS - 1U)) && (bins[i] != nullptr)) {
+            carry = mergeRuns(bins[i], carry, comp);
+            ++i;
+        }
+
+        if (bins[i] != nullptr) {
+            carry = mergeRuns(bins[i], carry, comp);
+        }
+
+        bins[i] = carry;
+        carry = nullptr;
+    }
+
+    for (auto*& bin : bins) {
+        if (bin != nullptr) {
+            if (carry != nullptr) {
+                carry = mergeRuns(bin, carry, comp);
+            } else {
+                carry = bin;
+                bin = nullptr;
+            }
+        }
+    }
+
+    unwind.active = false;
+    this->chain.attach(carry);
+}
+
+
+template<class T>
+template<class P>
+auto List<T>::unique(P pred) -> size_type {
+
+    size_type numErased = 0U;
+
+    if (!this->empty()) {
+
+        iterator prev = this->begin();
+        iterator it = prev;
+        ++it;
+
+        while (it != this->end()) {
+            if (pred(*prev, *it)) {
+                it = erase(it);
+                ++numErased;
+            } else {
+                prev = it;
+                ++it;
+            }
+        }
+    }
+
+    return numErased;
+}
+
+
+template<class T>
+template<class C>
+auto List<T>::mergeRuns(Detail::DoubleChain::Node*& a, Detail::DoubleChain::Node*& b, C& comp)
+    -> Detail::DoubleChain::Node* {
+
+    using ChainNode = Detail::DoubleChain::Node;
+
+    ChainNode head;
+    ChainNode* tail = &head;
+
+    // Leaves every node in `a` if `comp` throws.
+    struct Rest {
+        ChainNode& head;
+        ChainNode*& tail;
+        ChainNode*& a;
+        ChainNode*& b;
+
+        ~Rest() {
+            tail->next = (a != nullptr) ? a : b;
+            if ((a != nullptr) && (b != nullptr)) {
+                while (tail->next != nullptr) {
+                    tail = tail->next;
+                }
+                tail->next = b;
+            }
+            a = head.next;
+            b = nullptr;
+        }
+    };
+
+    {
+        Rest rest {head, tail, a, b};
+
+        while ((a != nullptr) && (b != nullptr)) {
+            if (comp(itemOf(b), itemOf(a))) {
+                tail->next = b;
+                b = b->next;
+            } else {
+                tail->next = a;
+                a = a->next;
+            }
+            tail = tail->next;
+        }
     }
+
+    ChainNode* merged = a;
+    a = nullptr;
+    return merged;
 }
 
 
@@ -353,6 +687,16 @@ void List<T>::push_front(const T& item) {
 }
 
 
+template<class T>
+void List<T>::push_front(T&& item) {
+
+    Node* p = createNode(std::move(item));
+    if (p != nullptr) {
+        Detail::AListBase::pushFront(*p);
+    }
+}
+
+
 template<class T>
 void List<T>::push_back(const T& item) {
 
@@ -363,6 +707,16 @@ void List<T>::push_back(const T& item) {
 }
 
 
+template<class T>
+void List<T>::push_back(T&& item) {
+
+    Node* p = createNode(std::move(item));
+    if (p != nullptr) {
+        Detail::AListBase::pushBack(*p);
+    }
+}
+
+
 template<class T>
 auto List<T>::insert(const_iterator pos, const T& item) -> iterator {
     return emplace(pos, item);
@@ -384,10 +738,79 @@ auto List<T>::emplace(const_iterator pos, Args&&... args) -> iterator {
 }
 
 
+template<class T>
+template<typename F>
+auto List<T>::insertNodes(const_iterator pos, size_type n, F make) -> iterator {
+
+    iterator res = Base::convert(pos);
+    bool first = true;
+
+    while (n > 0U) {
+
+        Node* nodes[BULK_SIZE];
+        const size_type req = (n < BULK_SIZE) ? n : BULK_SIZE;
+        const auto got = static_cast<size_type>(allocator.allocate_bulk(req, nodes));
+
+        // Returns the nodes not linked yet to the allocator if make() throws.
+        struct Remainder {
+            AllocatorBase& allocator;
+            Node** nodes;
+            size_type from;
+            size_type to;
+
+            ~Remainder() {
+                if (from < to) {
+                    allocator.deallocate_bulk(nodes + from, to - from);
+                }
+            }
+        } rest {allocator, nodes, 0U, got};
+
+        for (; rest.from < got; ++rest.from) {
+            make(nodes[rest.from]);
+            iterator it = Base::insert(pos, *nodes[rest.from]);
+            if (first) {
+                res = it;
+                first = false;
+            }
+        }
+
+        n = (got < req) ? 0U : (n - got);
+    }
+
+    return res;
+}
+
+
 template<class T>
 template<typename InputIt>
 enable_if_t<Detail::IsInputIterator<InputIt>::value, typename List<T>::iterator>
 List<T>::insert(const_iterator position, InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    return insertRange(position, first, last, Category());
+}
+
+
+template<class T>
+template<typename ForwardIt>
+auto List<T>::insertRange(const_iterator pos,
+                          ForwardIt first,
+                          ForwardIt last,
+                          std::forward_iterator_tag) -> iterator {
+
+    const auto n = static_cast<size_type>(std::distance(first, last));
+    return insertNodes(pos, n, [&first](Node* p) {
+        new (p) Node(*first);
+        ++first;
+    });
+}
+
+
+template<class T>
+template<typename InputIt>
+auto List<T>::insertRange(const_iterator position,
+                          InputIt first,
+                          InputIt last,
+                          std::input_iterator_tag) -> iterator {
 
     iterator res = Base::convert(position);
 
@@ -420,6 +843,23 @@ void List<T>::splice(const_iterator pos,
 }
 
 
+template<class T>
+void List<T>::splice(const_iterator pos,
+                     List<T>& other,
+                     const_iterator first,
+                     const_iterator last,
+                     size_type num) {
+
+    if (this != &other) {
+        if (allocator.handle() == other.allocator.handle()) {
+            Detail::AListBase::splice(pos, other, first, last, num);
+        } else {
+            spliceElements(pos, other, first, last);
+        }
+    }
+}
+
+
 template<class T>
 void List<T>::spliceElements(const_iterator pos,
                              List<T>& other,
@@ -495,6 +935,14 @@ void swap(List<T>& lhs, List<T>& rhs) {
     lhs.swap(rhs);
 }
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class T, class P>
+typename List<T>::size_type erase_if(List<T>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_LISTTEMPLATE_H_
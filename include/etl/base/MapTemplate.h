@@ -100,7 +100,7 @@ class Map : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCompare
     }
 
     E& operator[](K&& k) {
-        return getItem(k)->second;
+        return getItem(std::move(k))->second;
     }
     /// \}
 
@@ -120,6 +120,7 @@ class Map : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCompare
     /// \{
     using Base::clear;
     using Base::erase;
+    using Base::remove_if;
 
     void erase(const K& k);
 
@@ -127,6 +128,10 @@ class Map : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCompare
         return Base::insertUnique(item);
     }
 
+    std::pair<iterator, bool> insert(value_type&& item) {
+        return Base::insertUnique(std::move(item));
+    }
+
     template<class InputIt>
     enable_if_t<!is_integral<InputIt>::value> insert(InputIt first, InputIt last) {
         while (first != last) {
@@ -144,9 +149,24 @@ class Map : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCompare
     }
 
     template<typename... Args>
-    inline std::pair<iterator, bool> emplace(const K& k, Args&&... args);
+    std::pair<iterator, bool> emplace(const K& k, Args&&... args) {
+        return emplaceWithKey(k, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(K&& k, Args&&... args) {
+        return emplaceWithKey(std::move(k), std::forward<Args>(args)...);
+    }
 
-    std::pair<iterator, bool> insert_or_assign(const K& k, const E& e);
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const K& k, M&& e) {
+        return insertOrAssign(k, std::forward<M>(e));
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(K&& k, M&& e) {
+        return insertOrAssign(std::move(k), std::forward<M>(e));
+    }
 
     void swap(Map& other) {
         Base::swap(other);
@@ -166,6 +186,10 @@ class Map : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCompare
         Base::swapNodeList(other);
     }
 
+    void dropNodes() noexcept {
+        Base::dropNodes();
+    }
+
     template<typename InputIt>
     void assign(InputIt first, InputIt last) {
         this->clear();
@@ -180,19 +204,32 @@ class Map : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCompare
     iterator getItem(const K& k) {
         return emplace(k, E()).first;
     }
+
+    iterator getItem(K&& k) {
+        return emplace(std::move(k), E()).first;
+    }
+
+  private:
+
+    template<typename KK, typename... Args>
+    std::pair<iterator, bool> emplaceWithKey(KK&& k, Args&&... args);
+
+    template<typename KK, typename M>
+    std::pair<iterator, bool> insertOrAssign(KK&& k, M&& e);
 };
 
 
 template<class K, class E, class C>
-auto Map<K, E, C>::insert_or_assign(const K& k, const E& e) -> std::pair<iterator, bool> {
+template<typename KK, typename M>
+auto Map<K, E, C>::insertOrAssign(KK&& k, M&& e) -> std::pair<iterator, bool> {
 
     auto found = Base::findSortedPosition(k);
 
     if (found.second == false) {
-        found.first = Base::emplaceTo(found.first, k, e);
+        found.first = Base::emplaceTo(found.first, std::forward<KK>(k), std::forward<M>(e));
     } else {
         --found.first;
-        found.first->second = e;
+        found.first->second = std::forward<M>(e);
     }
 
     found.second = !found.second;
@@ -238,13 +275,14 @@ auto Map<K, E, C>::find(const K& k) const -> const_iterator {
 
 
 template<class K, class E, class C>
-template<typename... Args>
-auto Map<K, E, C>::emplace(const K& k, Args&&... args) -> std::pair<iterator, bool> {
+template<typename KK, typename... Args>
+auto Map<K, E, C>::emplaceWithKey(KK&& k, Args&&... args) -> std::pair<iterator, bool> {
 
     auto found = Base::findSortedPosition(k);
 
     if (found.second == false) {
-        found.first = Base::emplaceTo(found.first, k, std::forward<Args>(args)...);
+        found.first =
+            Base::emplaceTo(found.first, std::forward<KK>(k), std::forward<Args>(args)...);
     } else {
         --found.first;
     }
@@ -290,6 +328,14 @@ void swap(Map<K, E, C>& lhs, Map<K, E, C>& rhs) {
     lhs.swap(rhs);
 }
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class K, class E, class C, class P>
+typename Map<K, E, C>::size_type erase_if(Map<K, E, C>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_MAPTEMPLATE_H_
@@ -161,9 +161,17 @@ void StaticSized<C>::setupData(C& cont, size_type length) {
 }
 
 
+/// Allocators of the same handle share the storage, so the containers can swap it.
 template<class A>
 struct DynamicStrategyTraits {
+
     static constexpr bool uniqueAllocator = false;
+
+    static const void* handleOf(const A& a) noexcept {
+        (void)a;
+        static const int h {};
+        return &h;
+    }
 };
 
 
@@ -186,6 +194,11 @@ class DynamicSized : public AMemStrategy<C> {
 
   public:  // functions
 
+    DynamicSized() = default;
+
+    explicit DynamicSized(const A& a) noexcept :
+        allocator {a} {}
+
     size_type getMaxCapacity() const noexcept final {
         return std::numeric_limits<size_type>::max();
     }
@@ -230,8 +243,7 @@ class DynamicSized : public AMemStrategy<C> {
 
     template<bool T = uniqueAllocator>
     enable_if_t<!T, const void*> getHandle() const noexcept {
-        static const int h {};
-        return &h;
+        return DynamicStrategyTraits<A>::handleOf(allocator);
     }
 
     template<class INS>
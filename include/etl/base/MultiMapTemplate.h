@@ -108,6 +108,7 @@ class MultiMap : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCo
     /// \{
     using Base::clear;
     using Base::erase;
+    using Base::remove_if;
 
     size_type erase(const K& k);
 
@@ -115,6 +116,10 @@ class MultiMap : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCo
         return Base::insert(item);
     }
 
+    iterator insert(value_type&& item) {
+        return Base::insert(std::move(item));
+    }
+
     template<class InputIt>
     enable_if_t<!is_integral<InputIt>::value> insert(InputIt first, InputIt last) {
         while (first != last) {
@@ -132,7 +137,14 @@ class MultiMap : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCo
     }
 
     template<typename... Args>
-    inline iterator emplace(const K& k, Args&&... args);
+    iterator emplace(const K& k, Args&&... args) {
+        return emplaceWithKey(k, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    iterator emplace(K&& k, Args&&... args) {
+        return emplaceWithKey(std::move(k), std::forward<Args>(args)...);
+    }
 
     void swap(MultiMap& other) {
         Base::swap(other);
@@ -177,6 +189,10 @@ class MultiMap : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCo
         Base::swapNodeList(other);
     }
 
+    void dropNodes() noexcept {
+        Base::dropNodes();
+    }
+
     template<typename InputIt>
     void assign(InputIt first, InputIt last) {
         this->clear();
@@ -187,6 +203,11 @@ class MultiMap : private Detail::SortedList<std::pair<const K, E>, Detail::KeyCo
     void assign(const Cont& other) {
         assign(other.begin(), other.end());
     }
+
+  private:
+
+    template<typename KK, typename... Args>
+    iterator emplaceWithKey(KK&& k, Args&&... args);
 };
 
 
@@ -233,11 +254,12 @@ auto MultiMap<K, E, C>::find(const K& k) const -> const_iterator {
 
 
 template<class K, class E, class C>
-template<typename... Args>
-auto MultiMap<K, E, C>::emplace(const K& k, Args&&... args) -> iterator {
+template<typename KK, typename... Args>
+auto MultiMap<K, E, C>::emplaceWithKey(KK&& k, Args&&... args) -> iterator {
 
     auto found = Base::findSortedPosition(k);
-    found.first = Base::emplaceTo(found.first, k, std::forward<Args>(args)...);
+    found.first =
+        Base::emplaceTo(found.first, std::forward<KK>(k), std::forward<Args>(args)...);
 
     return found.first;
 }
@@ -279,6 +301,14 @@ void swap(MultiMap<K, E, C>& lhs, MultiMap<K, E, C>& rhs) {
     lhs.swap(rhs);
 }
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class K, class E, class C, class P>
+typename MultiMap<K, E, C>::size_type erase_if(MultiMap<K, E, C>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_MULTIMAPTEMPLATE_H_
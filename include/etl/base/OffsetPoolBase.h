@@ -0,0 +1,92 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_OFFSETPOOLBASE_H_
+#define ETL_OFFSETPOOLBASE_H_
+
+#include <etl/base/OffsetPtr.h>
+#include <etl/etlSupport.h>
+
+#include <cstddef>
+
+namespace ETL_NAMESPACE {
+namespace Detail {
+
+/**
+Fixed pool core like PoolBase, with all the links stored as OffsetPtr.
+Both the pool and the items are expected to be in the same relocatable memory region.
+*/
+class OffsetPoolBase {
+
+  public:  // types
+
+    struct FreeItem {
+        OffsetPtr<FreeItem> next;
+    };
+
+  private:  // variables
+
+    OffsetPtr<std::uint8_t> data;
+    std::size_t itemSize;
+    std::size_t size_;
+
+    OffsetPtr<FreeItem> freeList;
+    std::size_t freeCnt;
+    std::size_t nextFreeIx;
+
+  public:  // functions
+
+    /// \param d start of the items, aligned for `FreeItem`
+    /// \param is item size, at least `sizeof(FreeItem)` and a multiple of its alignment
+    /// \param n number of items
+    OffsetPoolBase(void* d, std::size_t is, std::size_t n) noexcept;
+
+    OffsetPoolBase() = delete;
+    OffsetPoolBase(const OffsetPoolBase& other) = delete;
+    OffsetPoolBase& operator=(const OffsetPoolBase& other) = delete;
+    OffsetPoolBase(OffsetPoolBase&& other) = delete;
+    OffsetPoolBase& operator=(OffsetPoolBase&& other) = delete;
+
+    void* pop() noexcept;
+    bool push(void* item) noexcept;
+
+    /// Releases all items at once.
+    /// \note Items still in use are invalidated.
+    void reset() noexcept;
+
+    std::size_t getFreeCount() const noexcept {
+        return freeCnt;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    std::size_t getItemSize() const noexcept {
+        return itemSize;
+    }
+};
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_OFFSETPOOLBASE_H_
@@ -0,0 +1,130 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_OFFSETPTR_H_
+#define ETL_OFFSETPTR_H_
+
+#include <etl/etlSupport.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ETL_NAMESPACE {
+namespace Detail {
+
+/**
+Self-relative pointer.
+Stores the distance of the target from the pointer itself, so a structure linked by
+OffsetPtr remains valid when the memory holding it is mapped or copied to another address.
+\note Copying an OffsetPtr recalculates the offset for the new location.
+*/
+template<class T>
+class OffsetPtr {
+
+  private:  // constants
+
+    // An offset of one byte would point into the pointer itself.
+    static constexpr std::ptrdiff_t NULL_OFFSET {1};
+
+  private:  // variables
+
+    std::ptrdiff_t offset;
+
+  public:  // functions
+
+    OffsetPtr() noexcept :
+        offset {NULL_OFFSET} {}
+
+    explicit OffsetPtr(T* ptr) noexcept :
+        offset {offsetOf(ptr)} {}
+
+    OffsetPtr(const OffsetPtr& other) noexcept :
+        offset {offsetOf(other.get())} {}
+
+    OffsetPtr& operator=(const OffsetPtr& other) noexcept {
+        offset = offsetOf(other.get());
+        return *this;
+    }
+
+    OffsetPtr& operator=(T* ptr) noexcept {
+        offset = offsetOf(ptr);
+        return *this;
+    }
+
+    ~OffsetPtr() = default;
+
+    T* get() const noexcept {
+        return (offset == NULL_OFFSET)
+                   ? nullptr
+                   : reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(this) + offset);
+    }
+
+    T* operator->() const noexcept {
+        return get();
+    }
+
+    T& operator*() const noexcept {
+        return *get();
+    }
+
+    explicit operator bool() const noexcept {
+        return offset != NULL_OFFSET;
+    }
+
+  private:
+
+    std::ptrdiff_t offsetOf(const T* ptr) const noexcept {
+        return (ptr == nullptr) ? NULL_OFFSET
+                                : static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(ptr)
+                                                              - reinterpret_cast<std::uintptr_t>(this));
+    }
+};
+
+template<class T>
+constexpr std::ptrdiff_t OffsetPtr<T>::NULL_OFFSET;
+
+
+/// Returns `ptr` aligned up to `align`, a power of two.
+inline void* alignUp(void* ptr, std::size_t align) noexcept {
+    const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+    return reinterpret_cast<void*>((addr + align - 1U) & ~static_cast<std::uintptr_t>(align - 1U));
+}
+
+inline bool isAligned(const void* ptr, std::size_t align) noexcept {
+    return (reinterpret_cast<std::uintptr_t>(ptr) % align) == 0U;
+}
+
+
+/// Identifies a relocatable structure placed at the start of a memory region.
+struct RegionTag {
+    std::uint32_t magic;
+    std::uint32_t layout;  // Element size, to catch mismatching types
+
+    bool matches(std::uint32_t m, std::size_t l) const noexcept {
+        return (magic == m) && (layout == l);
+    }
+};
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_OFFSETPTR_H_
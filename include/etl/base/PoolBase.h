@@ -22,6 +22,7 @@ limitations under the License.
 #ifndef ETL_POOLBASE_H_
 #define ETL_POOLBASE_H_
 
+#include <etl/base/PoolStats.h>
 #include <etl/base/Proxy.h>
 #include <etl/etlSupport.h>
 
@@ -49,6 +50,10 @@ class PoolBase {
     std::size_t freeCnt;
     std::size_t nextFreeIx;
 
+#if ETL_POOL_STATS
+    PoolStats stats {};
+#endif
+
   public:  // functions
 
     explicit PoolBase(const Detail::Proxy& d) noexcept :
@@ -65,9 +70,28 @@ class PoolBase {
     void* pop() noexcept;
     bool push(void* item) noexcept;
 
+    /// Releases all items at once, without touching the item memory.
+    /// \note Items still in use are invalidated.
+    void reset() noexcept {
+#if ETL_POOL_STATS
+        stats.frees += data.size() - freeCnt;
+#endif
+        freeList.next = nullptr;
+        freeCnt = data.size();
+        nextFreeIx = 0U;
+    }
+
     std::size_t getFreeCount() const noexcept {
         return freeCnt;
     }
+
+    PoolStats getStats() const noexcept {
+#if ETL_POOL_STATS
+        return stats;
+#else
+        return PoolStats {};
+#endif
+    }
 };
 
 }  // namespace Detail
@@ -0,0 +1,42 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_POOLSTATS_H_
+#define ETL_POOLSTATS_H_
+
+#include <etl/etlSupport.h>
+
+namespace ETL_NAMESPACE {
+
+/// Usage counters of a pool, collected only when `ETL_POOL_STATS` is enabled.
+struct PoolStats {
+    std::size_t highWater;    ///< Maximal number of items allocated at the same time
+    std::size_t failures;     ///< Allocations failed as the pool was exhausted or the
+                              ///< number of items requested was not supported
+    std::size_t allocations;  ///< Successful allocations
+    std::size_t frees;        ///< Successful deallocations
+    std::size_t contentions;  ///< Lock attempts finding the lock taken
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_POOLSTATS_H_
@@ -0,0 +1,617 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_SEGMENTEDVECTORTEMPLATE_H_
+#define ETL_SEGMENTEDVECTORTEMPLATE_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/VectorTemplate.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+
+/**
+Sequence container storing its elements in fixed-size chunks.
+The chunks are allocated one by one via an AAllocator and are indexed by a directory.
+Elements are never relocated when the container grows, so references, pointers
+and iterators to existing elements stay valid until the element is removed.
+\tparam T Item type
+\tparam K Number of items in one chunk
+*/
+template<class T, std::size_t K = 16U>
+class SegmentedVector {
+
+    static_assert(K > 0U, "Invalid Etl::SegmentedVector<> chunk size");
+
+  public:  // types
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    using size_type = std::uint32_t;
+    using difference_type = std::ptrdiff_t;
+
+    struct Chunk {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type items[K];
+    };
+
+    using Directory = Vector<Chunk*>;
+    using AllocatorBase = AAllocator<Chunk>;
+
+    template<class V>
+    class Iterator;
+
+    using iterator = Iterator<SegmentedVector>;
+    using const_iterator = Iterator<const SegmentedVector>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::size_t CHUNK_SIZE {K};
+
+  private:  // variables
+
+    Directory& directory;
+    AllocatorBase& allocator;
+    size_type size_ {0U};
+
+  public:  // functions
+
+    /// \name Construction, destruction, assignment
+    /// \{
+    SegmentedVector& operator=(const SegmentedVector& other) {
+        if (&other != this) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& other) {
+        swap(other);
+        return *this;
+    }
+
+    SegmentedVector& operator=(std::initializer_list<T> initList) {
+        assign(initList);
+        return *this;
+    }
+
+    SegmentedVector(const SegmentedVector& other) = delete;
+    SegmentedVector(SegmentedVector&& other) = delete;
+    ~SegmentedVector() = default;
+
+    void assign(size_type num, const_reference value);
+
+    template<typename InputIt>
+    enable_if_t<Detail::IsInputIterator<InputIt>::value> assign(InputIt first, InputIt last);
+
+    void assign(std::initializer_list<T> initList) {
+        assign(initList.begin(), initList.end());
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return (size_ == 0U);
+    }
+
+    size_type capacity() const noexcept {
+        return static_cast<size_type>(directory.size() * K);
+    }
+
+    size_type max_size() const noexcept;
+
+    void reserve(size_type length);
+    void shrink_to_fit() noexcept;
+    /// \}
+
+    /// \name Element access
+    /// \{
+    reference operator[](size_type ix) noexcept {
+        return *slot(ix);
+    }
+
+    const_reference operator[](size_type ix) const noexcept {
+        return *slot(ix);
+    }
+
+    reference front() noexcept {
+        return *slot(0U);
+    }
+
+    const_reference front() const noexcept {
+        return *slot(0U);
+    }
+
+    reference back() noexcept {
+        return *slot(size_ - 1U);
+    }
+
+    const_reference back() const noexcept {
+        return *slot(size_ - 1U);
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return iterator(*this, 0U);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(*this, 0U);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(*this, size_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(*this, size_);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    void clear() noexcept(std::is_nothrow_destructible<T>::value);
+
+    void push_back(const_reference value) {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args);
+
+    void pop_back() noexcept(std::is_nothrow_destructible<T>::value);
+
+    void resize(size_type length);
+    void resize(size_type length, const_reference value);
+
+    void swap(SegmentedVector& other);
+    /// \}
+
+  protected:
+
+    SegmentedVector(Directory& d, AllocatorBase& a) noexcept :
+        directory(d),
+        allocator(a) {}
+
+    /// Destroys all elements and returns all chunks to the allocator.
+    void cleanup() noexcept(std::is_nothrow_destructible<T>::value) {
+        clear();
+        releaseChunks(0U);
+    }
+
+  private:
+
+    pointer slot(size_type ix) noexcept {
+        return reinterpret_cast<pointer>(&directory[ix / K]->items[ix % K]);
+    }
+
+    const_pointer slot(size_type ix) const noexcept {
+        return reinterpret_cast<const_pointer>(&directory[ix / K]->items[ix % K]);
+    }
+
+    bool allocateChunk();
+    void releaseChunks(size_type keep) noexcept;
+
+    void swapElements(SegmentedVector& other);
+
+    friend bool operator==(const SegmentedVector& lhs, const SegmentedVector& rhs) {
+        return Detail::isEqual(lhs, rhs);
+    }
+
+    friend bool operator!=(const SegmentedVector& lhs, const SegmentedVector& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const SegmentedVector& lhs, const SegmentedVector& rhs) {
+        return Detail::isLess(lhs, rhs);
+    }
+
+    friend bool operator<=(const SegmentedVector& lhs, const SegmentedVector& rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>(const SegmentedVector& lhs, const SegmentedVector& rhs) {
+        return (rhs < lhs);
+    }
+
+    friend bool operator>=(const SegmentedVector& lhs, const SegmentedVector& rhs) {
+        return !(lhs < rhs);
+    }
+
+    friend void swap(SegmentedVector& lhs, SegmentedVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+
+/// Random access iterator of SegmentedVector, addressing items by index.
+template<class T, std::size_t K>
+template<class V>
+class SegmentedVector<T, K>::Iterator {
+
+    friend class SegmentedVector<T, K>;
+    friend class Iterator<const SegmentedVector<T, K>>;
+
+  public:  // types
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename Detail::CopyConst<V, T>::Type*;
+    using reference = typename Detail::CopyConst<V, T>::Type&;
+
+  private:  // variables
+
+    V* cont;
+    size_type ix;
+
+  public:  // functions
+
+    Iterator() noexcept :
+        cont(nullptr),
+        ix(0U) {}
+
+    template<class U, enable_if_t<std::is_same<const U, V>::value, bool> = true>
+    Iterator(const Iterator<U>& other) noexcept :
+        cont(other.cont),
+        ix(other.ix) {}
+
+    reference operator*() const noexcept {
+        return (*cont)[ix];
+    }
+
+    pointer operator->() const noexcept {
+        return &(*cont)[ix];
+    }
+
+    reference operator[](difference_type n) const noexcept {
+        return (*cont)[ix + n];
+    }
+
+    Iterator& operator++() noexcept {
+        ++ix;
+        return *this;
+    }
+
+    Iterator& operator--() noexcept {
+        --ix;
+        return *this;
+    }
+
+    const Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++ix;
+        return old;
+    }
+
+    const Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        --ix;
+        return old;
+    }
+
+    Iterator& operator+=(difference_type n) noexcept {
+        ix += n;
+        return *this;
+    }
+
+    Iterator& operator-=(difference_type n) noexcept {
+        ix -= n;
+        return *this;
+    }
+
+    Iterator operator+(difference_type n) const noexcept {
+        return Iterator(*cont, ix + n);
+    }
+
+    Iterator operator-(difference_type n) const noexcept {
+        return Iterator(*cont, ix - n);
+    }
+
+    difference_type operator-(const Iterator& other) const noexcept {
+        return static_cast<difference_type>(ix) - static_cast<difference_type>(other.ix);
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+        return (cont == other.cont) && (ix == other.ix);
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+        return !(operator==(other));
+    }
+
+    bool operator<(const Iterator& other) const noexcept {
+        return ix < other.ix;
+    }
+
+    bool operator>(const Iterator& other) const noexcept {
+        return other < *this;
+    }
+
+    bool operator<=(const Iterator& other) const noexcept {
+        return !(other < *this);
+    }
+
+    bool operator>=(const Iterator& other) const noexcept {
+        return !(*this < other);
+    }
+
+  private:
+
+    Iterator(V& c, size_type i) noexcept :
+        cont(&c),
+        ix(i) {}
+
+    friend Iterator operator+(difference_type n, const Iterator& it) noexcept {
+        return it + n;
+    }
+};
+
+
+template<class T, std::size_t K>
+constexpr std::size_t SegmentedVector<T, K>::CHUNK_SIZE;
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::assign(size_type num, const_reference value) {
+
+    clear();
+    reserve(num);
+    for (size_type i = 0U; i < num; ++i) {
+        emplace_back(value);
+    }
+}
+
+
+template<class T, std::size_t K>
+template<typename InputIt>
+auto SegmentedVector<T, K>::assign(InputIt first, InputIt last)
+    -> enable_if_t<Detail::IsInputIterator<InputIt>::value> {
+
+    clear();
+    while (first != last) {
+        emplace_back(*first);
+        ++first;
+    }
+}
+
+
+template<class T, std::size_t K>
+auto SegmentedVector<T, K>::max_size() const noexcept -> size_type {
+
+    std::size_t numOfChunks = std::min(directory.max_size(), allocator.max_size());
+    std::size_t limit = std::numeric_limits<size_type>::max() / K;
+
+    return static_cast<size_type>(std::min(numOfChunks, limit) * K);
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::reserve(size_type length) {
+
+    while ((capacity() < length) && allocateChunk()) {}
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::shrink_to_fit() noexcept {
+
+    releaseChunks(static_cast<size_type>((size_ + K - 1U) / K));
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::clear() noexcept(std::is_nothrow_destructible<T>::value) {
+
+    while (size_ > 0U) {
+        pop_back();
+    }
+}
+
+
+template<class T, std::size_t K>
+template<typename... Args>
+void SegmentedVector<T, K>::emplace_back(Args&&... args) {
+
+    if ((size_ < capacity()) || allocateChunk()) {
+        new (slot(size_)) T(std::forward<Args>(args)...);
+        ++size_;
+    }
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::pop_back() noexcept(std::is_nothrow_destructible<T>::value) {
+
+    ETL_ASSERT(size_ > 0U);
+
+    --size_;
+    slot(size_)->~T();
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::resize(size_type length) {
+
+    while (size_ > length) {
+        pop_back();
+    }
+
+    reserve(length);
+    while ((size_ < length) && (size_ < capacity())) {
+        emplace_back();
+    }
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::resize(size_type length, const_reference value) {
+
+    while (size_ > length) {
+        pop_back();
+    }
+
+    reserve(length);
+    while ((size_ < length) && (size_ < capacity())) {
+        emplace_back(value);
+    }
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::swap(SegmentedVector& other) {
+
+    if (&other == this) {
+        return;
+    }
+
+    bool sameAllocator = (allocator.handle() == other.allocator.handle());
+    bool directoriesFit = (directory.max_size() >= other.directory.size())
+                          && (other.directory.max_size() >= directory.size());
+
+    if (sameAllocator && directoriesFit) {
+        directory.swap(other.directory);
+        std::swap(size_, other.size_);
+    } else {
+        swapElements(other);
+    }
+}
+
+
+template<class T, std::size_t K>
+bool SegmentedVector<T, K>::allocateChunk() {
+
+    if (directory.size() >= directory.max_size()) {
+        return false;
+    }
+
+    Chunk* chunk = allocator.allocate(1U);
+    if (chunk == nullptr) {
+        return false;
+    }
+
+    auto origSize = directory.size();
+    directory.push_back(chunk);
+    if (directory.size() == origSize) {
+        allocator.deallocate(chunk, 1U);
+        return false;
+    }
+
+    return true;
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::releaseChunks(size_type keep) noexcept {
+
+    while (directory.size() > keep) {
+        allocator.deallocate(directory.back(), 1U);
+        directory.pop_back();
+    }
+}
+
+
+template<class T, std::size_t K>
+void SegmentedVector<T, K>::swapElements(SegmentedVector& other) {
+
+    SegmentedVector& longer = (size_ >= other.size_) ? *this : other;
+    SegmentedVector& shorter = (size_ >= other.size_) ? other : *this;
+
+    shorter.reserve(longer.size_);
+    if (shorter.capacity() < longer.size_) {
+        return;
+    }
+
+    const size_type common = shorter.size_;
+    const size_type longerSize = longer.size_;
+
+    using std::swap;
+    for (size_type i = 0U; i < common; ++i) {
+        swap(longer[i], shorter[i]);
+    }
+
+    for (size_type i = common; i < longerSize; ++i) {
+        shorter.emplace_back(std::move(longer[i]));
+    }
+
+    while (longer.size_ > common) {
+        longer.pop_back();
+    }
+}
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_SEGMENTEDVECTORTEMPLATE_H_
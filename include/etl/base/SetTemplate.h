@@ -105,6 +105,7 @@ class Set : private Detail::SortedList<E, C> {
     /// \{
     using Base::clear;
     using Base::erase;
+    using Base::remove_if;
 
     void erase(const E& e);
 
@@ -112,6 +113,10 @@ class Set : private Detail::SortedList<E, C> {
         return Base::insertUnique(e);
     }
 
+    std::pair<iterator, bool> insert(E&& e) {
+        return Base::insertUnique(std::move(e));
+    }
+
     template<class InputIt>
     enable_if_t<!is_integral<InputIt>::value> insert(InputIt first, InputIt last) {
         while (first != last) {
@@ -141,6 +146,10 @@ class Set : private Detail::SortedList<E, C> {
         Base::swapNodeList(other);
     }
 
+    void dropNodes() noexcept {
+        Base::dropNodes();
+    }
+
     template<typename InputIt>
     void assign(InputIt first, InputIt last) {
         this->clear();
@@ -245,6 +254,14 @@ void swap(Set<E, C>& lhs, Set<E, C>& rhs) {
     lhs.swap(rhs);
 }
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class E, class C, class P>
+typename Set<E, C>::size_type erase_if(Set<E, C>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_SETTEMPLATE_H_
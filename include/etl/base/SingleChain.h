@@ -87,6 +87,12 @@ class SingleChain {
     void insertAfter(Node* pos, Node* node) noexcept;
     Node* removeAfter(Node* pos) noexcept;
 
+    /// Relinks the nodes following `before` up to and including `back` after `pos`.
+    /// The range may belong to another chain, `pos` must not be inside the range.
+    static void spliceAfter(Node* pos, Node* before, Node* back) noexcept;
+
+    void reverse() noexcept;
+
     void setEmpty() noexcept {
         frontNode.next = nullptr;
     }
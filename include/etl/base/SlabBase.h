@@ -0,0 +1,180 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_SLABBASE_H_
+#define ETL_SLABBASE_H_
+
+#include <etl/etlSupport.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ETL_NAMESPACE {
+namespace Detail {
+
+/**
+Slab allocator core over a caller-provided memory region.
+The region is split to pages of `pageSize` bytes. Small requests are served from
+size classes, each taking whole pages and carving them to blocks. The classes are
+powers of two by default, or can be configured. Requests larger than the largest
+class take a run of contiguous pages.
+Each class page keeps its own free list and live block count, so a page becomes
+free again when all its blocks are released. One empty page is kept per class
+to avoid taking and releasing a page on every allocation at a page boundary.
+*/
+class SlabBase {
+
+  public:  // types
+
+    struct FreeItem {
+        FreeItem* next;
+    };
+
+  private:  // types
+
+    struct PageInfo {
+        FreeItem* freeList;
+        uint32_t live;
+        uint32_t prev;
+        uint32_t next;
+        uint8_t tag;
+    };
+
+  public:  // constants
+
+    static constexpr std::size_t MIN_BLOCK {16U};
+    static constexpr std::size_t MAX_CLASSES {16U};
+    static constexpr std::size_t MAX_ALIGN {alignof(std::max_align_t)};
+    /// Bookkeeping bytes taken from the region for each page.
+    static constexpr std::size_t PAGE_INFO_SIZE {sizeof(PageInfo)};
+
+  private:  // constants
+
+    static constexpr uint8_t PAGE_FREE {0U};
+    static constexpr uint8_t PAGE_RUN {1U};
+    static constexpr uint8_t PAGE_CLASS {2U};
+    static constexpr uint32_t NO_PAGE {0xFFFFFFFFU};
+
+  private:  // variables
+
+    PageInfo* pageInfo;
+    uint8_t* pages;
+    std::size_t pageSize;
+    std::size_t pageCnt;
+    std::size_t classCnt;
+
+    std::size_t classSizes[MAX_CLASSES];
+    uint32_t partialPages[MAX_CLASSES];
+    std::size_t freeBlocks[MAX_CLASSES];
+    std::size_t freePages;
+    std::size_t usedBytes;
+
+  public:  // functions
+
+    /// Creates power-of-two size classes from `MIN_BLOCK` up to half of a page.
+    /// \param region start of the memory region, has to be aligned to `MAX_ALIGN`
+    /// \param size size of the region in bytes
+    /// \param pageSize page size, a power of two and at least `2 * MIN_BLOCK`
+    SlabBase(void* region, std::size_t size, std::size_t pageSize) noexcept;
+
+    /// Creates the given size classes, the power-of-two defaults are used when `num` is 0.
+    /// \param classSizes ascending block sizes, multiples of `MIN_BLOCK`, at most half of a page
+    /// \param num number of classes, at most `MAX_CLASSES`
+    SlabBase(void* region,
+             std::size_t size,
+             std::size_t pageSize,
+             const std::size_t* classSizes,
+             std::size_t num) noexcept;
+
+    SlabBase() = delete;
+    SlabBase(const SlabBase& other) = delete;
+    SlabBase& operator=(const SlabBase& other) = delete;
+    SlabBase(SlabBase&& other) = delete;
+    SlabBase& operator=(SlabBase&& other) = delete;
+
+    /// Returns `nullptr` when the region is exhausted
+    /// or when `align` is stronger than `MAX_ALIGN`.
+    void* allocate(std::size_t size, std::size_t align) noexcept;
+    /// \param size has to be the same as passed to `allocate()`
+    void deallocate(void* ptr, std::size_t size) noexcept;
+
+    /// Returns the number of blocks of `size` bytes still available.
+    std::size_t available(std::size_t size) const noexcept;
+
+    /// Total size of the pages.
+    std::size_t capacity() const noexcept {
+        return pageCnt * pageSize;
+    }
+
+    /// Bytes allocated, rounded to the block or page size.
+    std::size_t getUsed() const noexcept {
+        return usedBytes;
+    }
+
+    std::size_t getFreePageCount() const noexcept {
+        return freePages;
+    }
+
+    std::size_t getPageSize() const noexcept {
+        return pageSize;
+    }
+
+    std::size_t getClassCount() const noexcept {
+        return classCnt;
+    }
+
+    std::size_t getClassSize(std::size_t cl) const noexcept {
+        return classSizes[cl];
+    }
+
+  private:
+
+    std::size_t classOf(std::size_t size) const noexcept;
+
+    std::size_t blockSize(std::size_t cl) const noexcept {
+        return classSizes[cl];
+    }
+
+    std::size_t blocksPerPage(std::size_t cl) const noexcept {
+        return pageSize / classSizes[cl];
+    }
+
+    std::size_t pagesFor(std::size_t size) const noexcept {
+        return (size + pageSize - 1U) / pageSize;
+    }
+
+    uint8_t* pageAt(std::size_t page) const noexcept {
+        return pages + (page * pageSize);
+    }
+
+    uint8_t* takePages(std::size_t n, uint8_t tag) noexcept;
+    bool refill(std::size_t cl) noexcept;
+
+    void linkPartial(std::size_t cl, uint32_t page) noexcept;
+    void unlinkPartial(std::size_t cl, uint32_t page) noexcept;
+    void releaseClassPage(std::size_t cl, uint32_t page) noexcept;
+};
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_SLABBASE_H_
@@ -0,0 +1,516 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_SOAVECTORTEMPLATE_H_
+#define ETL_SOAVECTORTEMPLATE_H_
+
+#include <etl/Span.h>
+#include <etl/base/VectorTemplate.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+
+/**
+Structure-of-arrays container.
+Each field of the rows is stored in a separate contiguous column, a `Vector<>`
+of the field type. The columns are provided by the derived classes, so the
+memory strategy of the columns is the one of the derived class.
+Rows are accessed via tuples of references, columns are accessible as `Span`.
+\tparam Ts Field types of a row
+*/
+template<class... Ts>
+class SoAVector {
+
+    static_assert(sizeof...(Ts) > 0U, "Etl::SoAVector<> needs at least one column");
+
+  public:  // types
+
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template<std::size_t I>
+    using ColumnType = typename std::tuple_element<I, value_type>::type;
+
+    template<class V, class R>
+    class Iterator;
+
+    using iterator = Iterator<SoAVector, reference>;
+    using const_iterator = Iterator<const SoAVector, const_reference>;
+
+    static constexpr std::size_t NUM_OF_COLUMNS {sizeof...(Ts)};
+
+  private:  // types
+
+    using Columns = std::tuple<Vector<Ts>*...>;
+    using Indices = typename Detail::MakeIndexSequence<sizeof...(Ts)>::Type;
+    using Expand = int[];
+
+  private:  // variables
+
+    Columns columns;
+
+  public:  // functions
+
+    /// \name Construction, destruction, assignment
+    /// \{
+    SoAVector& operator=(const SoAVector& other) {
+        if ((&other != this) && makeRoom(other.size())) {
+            assignColumns(other, Indices {});
+        }
+        return *this;
+    }
+
+    SoAVector& operator=(SoAVector&& other) {
+        swap(other);
+        return *this;
+    }
+
+    SoAVector(const SoAVector& other) = delete;
+    SoAVector(SoAVector&& other) = delete;
+    ~SoAVector() = default;
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    size_type size() const noexcept {
+        return std::get<0>(columns)->size();
+    }
+
+    bool empty() const noexcept {
+        return (size() == 0U);
+    }
+
+    /// Returns the smallest capacity of the columns.
+    size_type capacity() const noexcept {
+        return capacityOf(Indices {});
+    }
+
+    /// Returns the smallest max_size of the columns.
+    size_type max_size() const noexcept {
+        return maxSizeOf(Indices {});
+    }
+
+    void reserve(size_type length) {
+        reserveColumns(length, Indices {});
+    }
+
+    void shrink_to_fit() noexcept {
+        shrinkColumns(Indices {});
+    }
+    /// \}
+
+    /// \name Element access
+    /// \{
+    reference operator[](size_type ix) noexcept {
+        return rowAt(ix, Indices {});
+    }
+
+    const_reference operator[](size_type ix) const noexcept {
+        return rowAt(ix, Indices {});
+    }
+
+    reference front() noexcept {
+        return operator[](0U);
+    }
+
+    const_reference front() const noexcept {
+        return operator[](0U);
+    }
+
+    reference back() noexcept {
+        return operator[](size() - 1U);
+    }
+
+    const_reference back() const noexcept {
+        return operator[](size() - 1U);
+    }
+
+    /// Returns field `I` of row `ix`.
+    template<std::size_t I>
+    ColumnType<I>& get(size_type ix) noexcept {
+        return (*std::get<I>(columns))[ix];
+    }
+
+    template<std::size_t I>
+    const ColumnType<I>& get(size_type ix) const noexcept {
+        return (*std::get<I>(columns))[ix];
+    }
+
+    /// Returns column `I` as a contiguous range.
+    template<std::size_t I>
+    Span<ColumnType<I>> column() noexcept {
+        auto& col = *std::get<I>(columns);
+        return Span<ColumnType<I>>(col.data(), col.size());
+    }
+
+    template<std::size_t I>
+    Span<const ColumnType<I>> column() const noexcept {
+        const auto& col = *std::get<I>(columns);
+        return Span<const ColumnType<I>>(col.data(), col.size());
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return iterator(*this, 0U);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(*this, 0U);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(*this, size());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(*this, size());
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    void clear() noexcept {
+        clearColumns(Indices {});
+    }
+
+    /// Appends a row. Nothing happens if any of the columns can't grow.
+    void push_back(const Ts&... values) {
+        if (makeRoom(size() + 1U)) {
+            pushRow(Indices {}, values...);
+        }
+    }
+
+    void push_back(Ts&&... values) {
+        if (makeRoom(size() + 1U)) {
+            pushRow(Indices {}, std::move(values)...);
+        }
+    }
+
+    void pop_back() {
+        popRow(Indices {});
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        eraseRows(first.ix, last.ix, Indices {});
+        return iterator(*this, first.ix);
+    }
+
+    void resize(size_type length) {
+        if (makeRoom(length)) {
+            resizeColumns(length, Indices {});
+        }
+    }
+
+    /// Swaps the rows with `other`.
+    /// \return `false` if a column swapping elementwise has no room on either side,
+    ///         nothing is swapped then.
+    bool swap(SoAVector& other) {
+        if (&other == this) {
+            return true;
+        }
+
+        const bool fits = makeRoomForSwap(other, Indices {});
+        if (fits) {
+            swapColumns(other, Indices {});
+        }
+
+        return fits;
+    }
+    /// \}
+
+  protected:
+
+    SoAVector() noexcept = default;
+
+    /// Binds the columns stored by the derived class.
+    template<class S>
+    void bind(S& storage) noexcept {
+        bindColumns(storage, Indices {});
+    }
+
+  private:
+
+    bool makeRoom(size_type length) {
+        reserve(length);
+        return (capacity() >= length);
+    }
+
+    template<class S, std::size_t... Is>
+    void bindColumns(S& storage, Detail::IndexSequence<Is...>) noexcept {
+        columns = Columns(&std::get<Is>(storage)...);
+    }
+
+    template<std::size_t... Is>
+    reference rowAt(size_type ix, Detail::IndexSequence<Is...>) noexcept {
+        return reference((*std::get<Is>(columns))[ix]...);
+    }
+
+    template<std::size_t... Is>
+    const_reference rowAt(size_type ix, Detail::IndexSequence<Is...>) const noexcept {
+        return const_reference((*std::get<Is>(columns))[ix]...);
+    }
+
+    template<std::size_t... Is>
+    size_type capacityOf(Detail::IndexSequence<Is...>) const noexcept {
+        const size_type caps[] = {std::get<Is>(columns)->capacity()...};
+        return *std::min_element(std::begin(caps), std::end(caps));
+    }
+
+    template<std::size_t... Is>
+    size_type maxSizeOf(Detail::IndexSequence<Is...>) const noexcept {
+        const size_type sizes[] = {std::get<Is>(columns)->max_size()...};
+        return *std::min_element(std::begin(sizes), std::end(sizes));
+    }
+
+    template<std::size_t... Is>
+    void reserveColumns(size_type length, Detail::IndexSequence<Is...>) {
+        (void)Expand {0, (std::get<Is>(columns)->reserve(length), 0)...};
+    }
+
+    template<std::size_t... Is>
+    void shrinkColumns(Detail::IndexSequence<Is...>) noexcept {
+        (void)Expand {0, (std::get<Is>(columns)->shrink_to_fit(), 0)...};
+    }
+
+    template<std::size_t... Is>
+    void clearColumns(Detail::IndexSequence<Is...>) noexcept {
+        (void)Expand {0, (std::get<Is>(columns)->clear(), 0)...};
+    }
+
+    template<std::size_t... Is, class... Us>
+    void pushRow(Detail::IndexSequence<Is...>, Us&&... values) {
+        (void)Expand {0, (std::get<Is>(columns)->push_back(std::forward<Us>(values)), 0)...};
+    }
+
+    template<std::size_t... Is>
+    void popRow(Detail::IndexSequence<Is...>) {
+        (void)Expand {0, (std::get<Is>(columns)->pop_back(), 0)...};
+    }
+
+    template<std::size_t... Is>
+    void eraseRows(size_type first, size_type last, Detail::IndexSequence<Is...>) {
+        (void)Expand {0,
+                      (std::get<Is>(columns)->erase(std::get<Is>(columns)->begin() + first,
+                                                    std::get<Is>(columns)->begin() + last),
+                       0)...};
+    }
+
+    template<std::size_t... Is>
+    void resizeColumns(size_type length, Detail::IndexSequence<Is...>) {
+        (void)Expand {0, (std::get<Is>(columns)->resize(length), 0)...};
+    }
+
+    /// Columns with different strategies swap elementwise, so room is needed on both sides.
+    template<class V>
+    static bool makeRoomForSwap(V& own, V& other) {
+        if (own.swapsStorageWith(other)) {
+            return true;
+        }
+
+        own.reserve(other.size());
+        other.reserve(own.size());
+        return (own.capacity() >= other.size()) && (other.capacity() >= own.size());
+    }
+
+    template<std::size_t... Is>
+    bool makeRoomForSwap(SoAVector& other, Detail::IndexSequence<Is...>) {
+        const bool fits[] = {makeRoomForSwap(*std::get<Is>(columns), *std::get<Is>(other.columns))...};
+        return std::all_of(std::begin(fits), std::end(fits), [](bool f) { return f; });
+    }
+
+    template<std::size_t... Is>
+    void swapColumns(SoAVector& other, Detail::IndexSequence<Is...>) {
+        (void)Expand {0, (std::get<Is>(columns)->swap(*std::get<Is>(other.columns)), 0)...};
+    }
+
+    template<std::size_t... Is>
+    void assignColumns(const SoAVector& other, Detail::IndexSequence<Is...>) {
+        (void)Expand {0, (*std::get<Is>(columns) = *std::get<Is>(other.columns), 0)...};
+    }
+
+    template<std::size_t... Is>
+    bool isEqualColumns(const SoAVector& other, Detail::IndexSequence<Is...>) const {
+        const bool eq[] = {(*std::get<Is>(columns) == *std::get<Is>(other.columns))...};
+        return std::all_of(std::begin(eq), std::end(eq), [](bool e) { return e; });
+    }
+
+    friend bool operator==(const SoAVector& lhs, const SoAVector& rhs) {
+        return (&lhs == &rhs) || lhs.isEqualColumns(rhs, Indices {});
+    }
+
+    friend bool operator!=(const SoAVector& lhs, const SoAVector& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend void swap(SoAVector& lhs, SoAVector& rhs) {
+        lhs.swap(rhs);
+    }
+};
+
+
+/**
+Random access iterator of SoAVector, addressing rows by index.
+Dereferencing results a tuple of references to the fields of the row.
+*/
+template<class... Ts>
+template<class V, class R>
+class SoAVector<Ts...>::Iterator {
+
+    friend class SoAVector<Ts...>;
+    friend class Iterator<const SoAVector<Ts...>, const_reference>;
+
+  public:  // types
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename SoAVector<Ts...>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = R;
+
+  private:  // variables
+
+    V* cont;
+    size_type ix;
+
+  public:  // functions
+
+    Iterator() noexcept :
+        cont(nullptr),
+        ix(0U) {}
+
+    template<class U, class Q, enable_if_t<std::is_same<const U, V>::value, bool> = true>
+    Iterator(const Iterator<U, Q>& other) noexcept :
+        cont(other.cont),
+        ix(other.ix) {}
+
+    reference operator*() const noexcept {
+        return (*cont)[ix];
+    }
+
+    reference operator[](difference_type n) const noexcept {
+        return (*cont)[ix + n];
+    }
+
+    Iterator& operator++() noexcept {
+        ++ix;
+        return *this;
+    }
+
+    Iterator& operator--() noexcept {
+        --ix;
+        return *this;
+    }
+
+    const Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++ix;
+        return old;
+    }
+
+    const Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        --ix;
+        return old;
+    }
+
+    Iterator& operator+=(difference_type n) noexcept {
+        ix += n;
+        return *this;
+    }
+
+    Iterator& operator-=(difference_type n) noexcept {
+        ix -= n;
+        return *this;
+    }
+
+    Iterator operator+(difference_type n) const noexcept {
+        return Iterator(*cont, ix + n);
+    }
+
+    Iterator operator-(difference_type n) const noexcept {
+        return Iterator(*cont, ix - n);
+    }
+
+    difference_type operator-(const Iterator& other) const noexcept {
+        return static_cast<difference_type>(ix) - static_cast<difference_type>(other.ix);
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+        return (cont == other.cont) && (ix == other.ix);
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+        return !(operator==(other));
+    }
+
+    bool operator<(const Iterator& other) const noexcept {
+        return ix < other.ix;
+    }
+
+    bool operator>(const Iterator& other) const noexcept {
+        return other < *this;
+    }
+
+    bool operator<=(const Iterator& other) const noexcept {
+        return !(other < *this);
+    }
+
+    bool operator>=(const Iterator& other) const noexcept {
+        return !(*this < other);
+    }
+
+  private:
+
+    Iterator(V& c, size_type i) noexcept :
+        cont(&c),
+        ix(i) {}
+
+    friend Iterator operator+(difference_type n, const Iterator& it) noexcept {
+        return it + n;
+    }
+};
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_SOAVECTORTEMPLATE_H_
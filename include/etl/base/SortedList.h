@@ -41,6 +41,7 @@ class SortedList {
         using List<T>::List;
         using List<T>::operator=;
         using List<T>::swapNodeList;
+        using List<T>::dropNodes;
     };
 
     using value_type = typename Cont::value_type;
@@ -137,6 +138,11 @@ class SortedList {
         return list.erase(pos);
     }
 
+    template<class P>
+    size_type remove_if(P pred) noexcept(noexcept(std::declval<Cont>().remove_if(pred))) {
+        return list.remove_if(pred);
+    }
+
     void swap(SortedList& other) {
         list.swap(other.list);
     }
@@ -147,6 +153,10 @@ class SortedList {
         list.swapNodeList(other.list);
     }
 
+    void dropNodes() noexcept {
+        list.dropNodes();
+    }
+
   protected:
 
     template<typename It, typename CV, class CF>
@@ -186,12 +196,18 @@ class SortedList {
     }
 
     iterator insert(const_reference item);
+    iterator insert(value_type&& item);
     std::pair<iterator, bool> insertUnique(const_reference item);
+    std::pair<iterator, bool> insertUnique(value_type&& item);
 
     iterator insertTo(const_iterator pos, const_reference item) {
         return list.insert(pos, item);
     }
 
+    iterator insertTo(const_iterator pos, value_type&& item) {
+        return list.insert(pos, std::move(item));
+    }
+
     template<typename... Args>
     iterator emplaceTo(const_iterator pos, Args&&... args) {
         return list.emplace(pos, std::forward<Args>(args)...);
@@ -207,6 +223,14 @@ auto SortedList<T, Comp>::insert(const_reference item) -> iterator {
 }
 
 
+template<class T, class Comp>
+auto SortedList<T, Comp>::insert(value_type&& item) -> iterator {
+
+    auto found = findSortedPosition(item);
+    return list.insert(found.first, std::move(item));
+}
+
+
 template<class T, class Comp>
 auto SortedList<T, Comp>::insertUnique(const_reference item) -> std::pair<iterator, bool> {
 
@@ -228,6 +252,27 @@ auto SortedList<T, Comp>::insertUnique(const_reference item) -> std::pair<iterat
 }
 
 
+template<class T, class Comp>
+auto SortedList<T, Comp>::insertUnique(value_type&& item) -> std::pair<iterator, bool> {
+
+    auto found = findSortedPosition(item);
+
+    if (found.second == false) {
+
+        found.first = list.insert(found.first, std::move(item));
+        if (found.first != end()) {
+            found.second = true;
+        }
+
+    } else {
+        --found.first;
+        found.second = false;
+    }
+
+    return found;
+}
+
+
 template<class T, class Comp>
 template<typename It, typename CV, class CF>
 auto SortedList<T, Comp>::findSortedRangeBase(It it,
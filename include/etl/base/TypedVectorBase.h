@@ -34,7 +34,9 @@ limitations under the License.
 #undef min
 #undef max
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <new>
@@ -199,6 +201,10 @@ class TypedVectorBase : public AVectorBase {
         return erase(pos, next);
     }
 
+    template<class P>
+    size_type remove_if(P pred) noexcept(is_nothrow_move_assignable<T>::value
+                                         && noexcept(pred(std::declval<reference>())));
+
     void pop_front() noexcept(is_nothrow_move_assignable<T>::value) {
         erase(begin());
     }
@@ -379,6 +385,29 @@ struct TrivialElementOps {
         moveWithAssignment(src, dst, num);
     }
 
+    /// Swaps two non-overlapping ranges block-wise via a bounded scratch buffer.
+    void swapRanges(pointer lhs,
+                    pointer rhs,
+                    size_type num) noexcept {
+
+        static constexpr std::size_t SCRATCH_BYTES {256U};
+
+        alignas(T) unsigned char scratch[SCRATCH_BYTES];
+
+        auto* l = reinterpret_cast<unsigned char*>(lhs);
+        auto* r = reinterpret_cast<unsigned char*>(rhs);
+        const std::size_t total = num * sizeof(T);
+
+        std::size_t i = 0U;
+        while (i < total) {
+            const std::size_t bytes = std::min<std::size_t>(SCRATCH_BYTES, total - i);
+            std::memcpy(scratch, l + i, bytes);
+            std::memcpy(l + i, r + i, bytes);
+            std::memcpy(r + i, scratch, bytes);
+            i += bytes;
+        }
+    }
+
     void destruct(pointer startPos,
                   pointer endPos) noexcept {
         (void)startPos;
@@ -498,6 +527,16 @@ struct NonTrivialElementOps {
         }
     }
 
+    void swapRanges(pointer lhs,
+                    pointer rhs,
+                    size_type num) noexcept(is_nothrow_move_assignable<T>::value
+                                            && is_nothrow_move_constructible<T>::value) {
+        using std::swap;
+        for (size_type i = 0; i < num; ++i) {
+            swap(lhs[i], rhs[i]);
+        }
+    }
+
     void destruct(pointer startPos,
                   pointer endPos) noexcept(is_nothrow_destructible<T>::value) {
 
@@ -532,6 +571,56 @@ auto TypedVectorBase<T>::erase(iterator first,
 }
 
 
+template<class T>
+template<class P>
+auto TypedVectorBase<T>::remove_if(P pred) noexcept(
+    is_nothrow_move_assignable<T>::value && noexcept(pred(std::declval<reference>())))
+    -> size_type {
+
+    // Kept elements are compacted in one pass: each run of them is moved
+    // down to the end of the previous run with a single moveDown().
+    //
+    // |aaaXXbbbbXcc|  ->  |aaabbbbcc|XXX|
+    //                               destructed
+
+    iterator dst = begin();
+    while ((dst != end()) && (!pred(*dst))) {
+        ++dst;
+    }
+
+    // Each loop starts at an element already known to match, so the
+    // predicate is evaluated exactly once per element.
+    iterator src = dst;
+    while (src != end()) {
+
+        ++src;
+        while ((src != end()) && pred(*src)) {
+            ++src;
+        }
+
+        if (src != end()) {
+            iterator runEnd = src + 1;
+            while ((runEnd != end()) && (!pred(*runEnd))) {
+                ++runEnd;
+            }
+
+            size_type runLength = runEnd - src;
+            ops().moveDown(src, dst, runLength);
+            dst += runLength;
+            src = runEnd;
+        }
+    }
+
+    size_type numErased = end() - dst;
+    if (numErased > 0U) {
+        ops().destruct(dst, end());
+        proxy.setSize(size() - numErased);
+    }
+
+    return numErased;
+}
+
+
 template<class T>
 void TypedVectorBase<T>::copyOperation(pointer dst, const_pointer src, size_type num) noexcept(
     is_nothrow_copy_assignable<T>::value&& is_nothrow_copy_constructible<T>::value) {
@@ -835,9 +924,7 @@ void TypedVectorBase<T>::swapElements(TypedVectorBase<T>& other) noexcept(
 
     const auto diff = sizeDiff(*this, other);
 
-    for (size_type i = 0; i < diff.common; ++i) {
-        this->swapValues(this->operator[](i), other[i]);
-    }
+    ops().swapRanges(data(), other.data(), diff.common);
 
     if (diff.rGreaterWith > 0) {
 
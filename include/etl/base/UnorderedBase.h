@@ -349,6 +349,10 @@ class UnorderedBase {
     void clear() noexcept(NodeAllocator::noexceptDestroy);
     iterator erase(iterator pos) noexcept(NodeAllocator::noexceptDestroy);
 
+    template<class P>
+    size_type remove_if(P pred) noexcept(NodeAllocator::noexceptDestroy
+                                         && noexcept(pred(std::declval<reference>())));
+
     template<typename H>
     void swap(H hasher, UnorderedBase& other) {
         if (this != &other) {
@@ -435,6 +439,12 @@ class UnorderedBase {
         hashTable.bindBuckets(buckets);
     }
 
+    /// Unlinks all nodes without destroying or deallocating them,
+    /// for derived classes releasing their own allocator as a whole.
+    void dropNodes() noexcept {
+        hashTable.dropNodes();
+    }
+
     /// \name Lookup
     /// \{
     std::pair<iterator, iterator> equalHashRange(HashType hash) {
@@ -492,6 +502,11 @@ class UnorderedBase {
         return emplace(std::move(hasher), item);
     }
 
+    template<typename H>
+    iterator insert(H hasher, value_type&& item) {
+        return emplace(std::move(hasher), std::move(item));
+    }
+
     template<typename H, typename... Args>
     iterator emplace(H hasher, Args&&... args);
 
@@ -558,6 +573,46 @@ class UnorderedBase {
         allocator.deallocate(node, 1U);
     }
 
+    /// Number of nodes released with one bulk allocator call.
+    static constexpr size_type BULK_SIZE {16U};
+
+    /// Collects destroyed nodes and returns them to the allocator in bulks.
+    class ReleaseBatch {
+
+        NodeAllocator& allocator;
+        Node* nodes[BULK_SIZE];
+        size_type cnt;
+
+      public:
+
+        explicit ReleaseBatch(NodeAllocator& a) noexcept :
+            allocator(a),
+            cnt(0U) {}
+
+        ReleaseBatch(const ReleaseBatch& other) = delete;
+        ReleaseBatch& operator=(const ReleaseBatch& other) = delete;
+
+        ~ReleaseBatch() {
+            flush();
+        }
+
+        void add(Node* node) noexcept(NodeAllocator::noexceptDestroy) {
+            NodeAllocator::destroy(node);
+            nodes[cnt] = node;
+            ++cnt;
+            if (cnt == BULK_SIZE) {
+                flush();
+            }
+        }
+
+        void flush() noexcept {
+            if (cnt > 0U) {
+                allocator.deallocate_bulk(nodes, cnt);
+                cnt = 0U;
+            }
+        }
+    };
+
     void rehashForNextInsertOnDemand() {
         auto rehashLimit = static_cast<size_t>(max_load_factor() * bucket_count());
         if ((size() + 1U) > rehashLimit) {
@@ -568,13 +623,14 @@ class UnorderedBase {
 };
 
 
+template<class T>
+constexpr typename UnorderedBase<T>::size_type UnorderedBase<T>::BULK_SIZE;
+
+
 template<class T>
 void UnorderedBase<T>::clear() noexcept(NodeAllocator::noexceptDestroy) {
 
-    auto it = begin();
-    while (it != end()) {
-        it = erase(it);
-    }
+    remove_if([](const_reference /*item*/) noexcept { return true; });
 
 #if ETL_ASSERTIONS_ON
     ETL_ASSERT(empty());
@@ -604,6 +660,35 @@ auto UnorderedBase<T>::erase(iterator pos) noexcept(NodeAllocator::noexceptDestr
 }
 
 
+template<class T>
+template<class P>
+auto UnorderedBase<T>::remove_if(P pred) noexcept(NodeAllocator::noexceptDestroy
+                                                  && noexcept(pred(std::declval<reference>())))
+    -> size_type {
+
+    ReleaseBatch released(allocator);
+    size_type numErased = 0U;
+
+    auto it = begin();
+    while (it != end()) {
+        if (pred(*it)) {
+            auto next = it;
+            ++next;
+            auto item = hashTable.remove(*it.node());
+            if (item != nullptr) {
+                released.add(static_cast<Node*>(item));
+            }
+            it = next;
+            ++numErased;
+        } else {
+            ++it;
+        }
+    }
+
+    return numErased;
+}
+
+
 template<class T>
 template<typename It, typename P>
 auto UnorderedBase<T>::findExactInRange(It first, It last, P predicate) const -> const_iterator {
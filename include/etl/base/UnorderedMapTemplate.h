@@ -113,7 +113,7 @@ class UnorderedMap : public Detail::UnorderedBase<std::pair<const K, E>> {
     }
 
     E& operator[](K&& k) {
-        return getItem(k)->second;
+        return getItem(std::move(k))->second;
     }
     /// \}
 
@@ -166,6 +166,7 @@ class UnorderedMap : public Detail::UnorderedBase<std::pair<const K, E>> {
     /// \{
     using Base::clear;
     using Base::erase;
+    using Base::remove_if;
 
     size_type erase(const key_type& k) {
         auto found = find(k);
@@ -181,6 +182,10 @@ class UnorderedMap : public Detail::UnorderedBase<std::pair<const K, E>> {
         return emplace(val);
     }
 
+    std::pair<iterator, bool> insert(value_type&& val) {
+        return emplace(std::move(val));
+    }
+
     std::pair<iterator, bool> insert(const K& k, const E& e) {
         return emplace(k, e);
     }
@@ -196,7 +201,15 @@ class UnorderedMap : public Detail::UnorderedBase<std::pair<const K, E>> {
     template<typename... Args>
     std::pair<iterator, bool> emplace(Args&&... args);
 
-    std::pair<iterator, bool> insert_or_assign(const K& k, const E& e);
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const K& k, M&& e) {
+        return insertOrAssign(k, std::forward<M>(e));
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(K&& k, M&& e) {
+        return insertOrAssign(std::move(k), std::forward<M>(e));
+    }
 
     void swap(UnorderedMap& other) {
         Base::swap(KeyHasher(), other);
@@ -234,6 +247,13 @@ class UnorderedMap : public Detail::UnorderedBase<std::pair<const K, E>> {
         return emplace(k, E()).first;
     }
 
+    iterator getItem(K&& k) {
+        return emplace(std::move(k), E()).first;
+    }
+
+    template<typename KK, typename M>
+    std::pair<iterator, bool> insertOrAssign(KK&& k, M&& e);
+
     friend bool operator==(const UnorderedMap& lhs, const UnorderedMap& rhs) {
 
         if (lhs.size() != rhs.size()) {
@@ -290,19 +310,27 @@ template<class K,
          class E,
          class H,
          class KE>
-auto UnorderedMap<K, E, H, KE>::insert_or_assign(const K& k, const E& e)
-    -> std::pair<iterator, bool> {
+template<typename KK, typename M>
+auto UnorderedMap<K, E, H, KE>::insertOrAssign(KK&& k, M&& e) -> std::pair<iterator, bool> {
 
     auto found = find(k);
     if (found == end()) {
-        auto it = Base::emplace(KeyHasher(), value_type(k, e));
+        auto it = Base::emplace(KeyHasher(), std::forward<KK>(k), std::forward<M>(e));
         return std::make_pair(it, (it != end()));
     } else {
-        found->second = e;
+        found->second = std::forward<M>(e);
         return std::make_pair(found, false);
     }
 }
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class K, class E, class H, class KE, class P>
+typename UnorderedMap<K, E, H, KE>::size_type erase_if(UnorderedMap<K, E, H, KE>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_UNORDEREDMAPTEMPLATE_H_
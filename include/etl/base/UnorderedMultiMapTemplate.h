@@ -157,6 +157,7 @@ class UnorderedMultiMap : public Detail::UnorderedBase<std::pair<const K, E>> {
     /// \{
     using Base::clear;
     using Base::erase;
+    using Base::remove_if;
 
     size_type erase(const key_type& k) {
         auto found = find(k);
@@ -172,6 +173,10 @@ class UnorderedMultiMap : public Detail::UnorderedBase<std::pair<const K, E>> {
         return emplace(val);
     }
 
+    iterator insert(value_type&& val) {
+        return emplace(std::move(val));
+    }
+
     iterator insert(const K& k, const E& e) {
         return emplace(k, e);
     }
@@ -256,6 +261,15 @@ class UnorderedMultiMap : public Detail::UnorderedBase<std::pair<const K, E>> {
 };
 
 
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class K, class E, class H, class KE, class P>
+typename UnorderedMultiMap<K, E, H, KE>::size_type
+erase_if(UnorderedMultiMap<K, E, H, KE>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_UNORDEREDMULTIMAPTEMPLATE_H_
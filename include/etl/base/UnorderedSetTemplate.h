@@ -140,6 +140,7 @@ class UnorderedSet : public Detail::UnorderedBase<K> {
     /// \{
     using Base::clear;
     using Base::erase;
+    using Base::remove_if;
 
     size_type erase(const key_type& k) {
         auto found = find(k);
@@ -155,6 +156,10 @@ class UnorderedSet : public Detail::UnorderedBase<K> {
         return emplace(val);
     }
 
+    std::pair<iterator, bool> insert(value_type&& val) {
+        return emplace(std::move(val));
+    }
+
     template<typename InputIt>
     enable_if_t<!is_integral<InputIt>::value, void> insert(InputIt first, InputIt last) {
         while (first != last) {
@@ -248,6 +253,14 @@ auto UnorderedSet<K, H, KE>::emplace(Args&&... args) -> std::pair<iterator, bool
     }
 }
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class K, class H, class KE, class P>
+typename UnorderedSet<K, H, KE>::size_type erase_if(UnorderedSet<K, H, KE>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 #endif  // ETL_UNORDEREDSETTEMPLATE_H_
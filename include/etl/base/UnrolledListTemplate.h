@@ -0,0 +1,790 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#ifndef ETL_UNROLLEDLISTTEMPLATE_H_
+#define ETL_UNROLLEDLISTTEMPLATE_H_
+
+#include <etl/base/AAllocator.h>
+#include <etl/base/DoubleChain.h>
+#include <etl/base/tools.h>
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace ETL_NAMESPACE {
+
+/**
+Unrolled linked list template with custom allocator.
+Each node holds up to `K` elements in an inline array, so iteration walks
+contiguous memory and follows a link only once per node. A full node is split
+on insertion and sparse neighbours are merged on erasure, both in O(K).
+\tparam T Element type
+\tparam K Maximum number of elements in a node
+\note Insertion and erasure invalidate the iterators of the affected node.
+*/
+template<class T, std::size_t K>
+class UnrolledList {
+
+    static_assert(K >= 2U, "Etl::UnrolledList<> node size shall be at least 2");
+
+  public:  // types
+
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    using size_type = std::uint32_t;
+
+    class Node : public Detail::DoubleChain::Node {
+
+      public:  // variables
+
+        size_type count {0U};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[K];
+
+      public:  // functions
+
+        T* items() noexcept {
+            return reinterpret_cast<T*>(slots);
+        }
+
+        const T* items() const noexcept {
+            return reinterpret_cast<const T*>(slots);
+        }
+    };
+
+    using AllocatorBase = AAllocator<Node>;
+
+    template<class V>
+    class Iterator;
+
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::size_t NODE_SIZE {K};
+
+  private:  // types
+
+    static constexpr bool noexceptDestroy =
+        AllocatorBase::noexceptDestroy && std::is_nothrow_destructible<T>::value;
+
+    /// Erasing relocates the following elements by move construction.
+    static constexpr bool noexceptErase =
+        noexceptDestroy && std::is_nothrow_move_constructible<T>::value;
+
+  private:  // variables
+
+    Detail::DoubleChain chain;
+    AllocatorBase& allocator;
+    size_type size_ {0U};
+
+  public:  // functions
+
+    /// \name Construction, destruction, assignment
+    /// \{
+
+    explicit UnrolledList(AllocatorBase& a) noexcept :
+        allocator {a} {}
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        if (&other != this) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) {
+        swap(other);
+        return *this;
+    }
+
+    UnrolledList& operator=(std::initializer_list<T> initList) {
+        assign(initList);
+        return *this;
+    }
+
+    UnrolledList(const UnrolledList& other) = delete;
+    UnrolledList(UnrolledList&& other) = delete;
+
+    ~UnrolledList() noexcept(noexceptDestroy) {
+        clear();
+    }
+
+    void assign(size_type num, const_reference value) {
+        clear();
+        insert(end(), num, value);
+    }
+
+    template<typename InputIt,
+             enable_if_t<Detail::IsInputIterator<InputIt>::value, bool> = true>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> initList) {
+        assign(initList.begin(), initList.end());
+    }
+    /// \}
+
+    /// \name Capacity
+    /// \{
+    bool empty() const noexcept {
+        return (size_ == 0U);
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    /// Returns the number of elements fitting in the nodes available from the allocator.
+    size_type max_size() const noexcept {
+        const std::size_t nodes = allocator.max_size();
+        const std::size_t limit = std::numeric_limits<size_type>::max() / K;
+        return static_cast<size_type>(((nodes < limit) ? nodes : limit) * K);
+    }
+    /// \}
+
+    /// \name Element access
+    /// \{
+    reference front() noexcept {
+        ETL_ASSERT(!empty());
+        return *begin();
+    }
+
+    const_reference front() const noexcept {
+        ETL_ASSERT(!empty());
+        return *begin();
+    }
+
+    reference back() noexcept {
+        ETL_ASSERT(!empty());
+        Node* last = lastNode();
+        return last->items()[last->count - 1U];
+    }
+
+    const_reference back() const noexcept {
+        ETL_ASSERT(!empty());
+        const Node* last = lastNode();
+        return last->items()[last->count - 1U];
+    }
+    /// \}
+
+    /// \name Iterators
+    /// \{
+    iterator begin() noexcept {
+        return iterator(chain.getFirst(), 0U);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(chain.getFirst(), 0U);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(chain.getLast()->next, 0U);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(chain.getLast()->next, 0U);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+    /// \}
+
+    /// \name Modifiers
+    /// \{
+    void clear() noexcept(noexceptDestroy);
+
+    void push_front(const T& item) {
+        emplace(begin(), item);
+    }
+
+    void push_front(T&& item) {
+        emplace(begin(), std::move(item));
+    }
+
+    void push_back(const T& item) {
+        emplace(end(), item);
+    }
+
+    void push_back(T&& item) {
+        emplace(end(), std::move(item));
+    }
+
+    template<typename... Args>
+    iterator emplace_front(Args&&... args) {
+        return emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    iterator emplace_back(Args&&... args) {
+        return emplace(end(), std::forward<Args>(args)...);
+    }
+
+    void pop_front() noexcept(noexceptErase) {
+        ETL_ASSERT(!empty());
+        erase(begin());
+    }
+
+    void pop_back() noexcept(noexceptErase) {
+        ETL_ASSERT(!empty());
+        Node* last = lastNode();
+        erase(const_iterator(last, last->count - 1U));
+    }
+
+    iterator insert(const_iterator pos, const T& item) {
+        return emplace(pos, item);
+    }
+
+    iterator insert(const_iterator pos, T&& item) {
+        return emplace(pos, std::move(item));
+    }
+
+    iterator insert(const_iterator pos, size_type n, const T& item);
+
+    template<typename InputIt>
+    enable_if_t<Detail::IsInputIterator<InputIt>::value, iterator>
+    insert(const_iterator pos, InputIt first, InputIt last);
+
+    iterator insert(const_iterator pos, std::initializer_list<T> initList) {
+        return insert(pos, initList.begin(), initList.end());
+    }
+
+    /// Constructs an element before `pos`, returns `end()` when the allocation fails.
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+
+    iterator erase(const_iterator pos) noexcept(noexceptErase);
+
+    iterator erase(const_iterator first, const_iterator last) noexcept(noexceptErase);
+
+    template<class P>
+    size_type remove_if(P pred);
+
+    void swap(UnrolledList& other);
+    /// \}
+
+  protected:
+
+    void swapNodeList(UnrolledList& other) noexcept {
+        chain.swap(other.chain);
+        std::swap(size_, other.size_);
+    }
+
+  private:
+
+    static Node* nodeOf(Detail::DoubleChain::Node* node) noexcept {
+        return static_cast<Node*>(node);
+    }
+
+    Node* lastNode() const noexcept {
+        return nodeOf(chain.getLast());
+    }
+
+    bool isNode(const Detail::DoubleChain::Node* node) const noexcept {
+        return (node != chain.getLast()->next) && (node != chain.getFirst()->prev);
+    }
+
+    Node* createNodeBefore(Detail::DoubleChain::Node* pos) {
+        Node* node = allocator.allocate(1U);
+        if (node != nullptr) {
+            allocator.construct(node);
+            chain.insertBefore(pos, node);
+        }
+        return node;
+    }
+
+    void deleteNode(Node* node) noexcept {
+        ETL_ASSERT(node->count == 0U);
+        chain.remove(node);
+        allocator.destroy(node);
+        allocator.deallocate(node, 1U);
+    }
+
+    /// Moves `n` constructed elements from `src` to uninitialized `dst`, the ranges may overlap.
+    template<class U = T>
+    static enable_if_t<is_trivial<U>::value> relocate(T* dst, T* src, size_type n) noexcept {
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+
+    template<class U = T>
+    static enable_if_t<!is_trivial<U>::value> relocate(T* dst, T* src, size_type n) noexcept(
+        noexceptErase) {
+        if (dst < src) {
+            for (size_type i = 0U; i < n; ++i) {
+                new (&dst[i]) T(std::move(src[i]));
+                src[i].~T();
+            }
+        } else if (dst > src) {
+            for (size_type i = n; i > 0U; --i) {
+                new (&dst[i - 1U]) T(std::move(src[i - 1U]));
+                src[i - 1U].~T();
+            }
+        }
+    }
+
+    /// Returns the node and index of a free slot for inserting before `pos`.
+    std::pair<Node*, size_type> makeRoomAt(const_iterator pos);
+
+    /// Steps back `n` positions, used to find the first of `n` inserted elements
+    /// as splitting a node may relocate the elements inserted earlier.
+    static iterator rewind(iterator it, size_type n) noexcept {
+        while (n > 0U) {
+            --it;
+            --n;
+        }
+        return it;
+    }
+
+    /// Merges the next node into `node` when they fit in half of a node.
+    void mergeWithNext(Node* node) noexcept(noexceptErase);
+};
+
+
+template<class T, std::size_t K>
+template<class V>
+class UnrolledList<T, K>::Iterator {
+
+    friend class UnrolledList<T, K>;
+    friend class Iterator<T>;
+    friend class Iterator<const T>;
+
+  public:  // types
+
+    using difference_type = int;
+    using value_type = T;
+    using pointer = V*;
+    using reference = V&;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+  private:  // variables
+
+    Detail::DoubleChain::Node* node;
+    size_type ix;
+
+  public:  // functions
+
+    Iterator() noexcept :
+        node(nullptr),
+        ix(0U) {}
+
+    template<class U, enable_if_t<std::is_same<const U, V>::value, bool> = true>
+    Iterator(const Iterator<U>& other) noexcept :
+        node(other.node),
+        ix(other.ix) {}
+
+    reference operator*() const noexcept {
+        return nodeOf(node)->items()[ix];
+    }
+
+    pointer operator->() const noexcept {
+        return &(nodeOf(node)->items()[ix]);
+    }
+
+    template<class U>
+    bool operator==(const Iterator<U>& other) const noexcept {
+        return (node == other.node) && (ix == other.ix);
+    }
+
+    template<class U>
+    bool operator!=(const Iterator<U>& other) const noexcept {
+        return !(operator==(other));
+    }
+
+    Iterator& operator++() noexcept {
+        ++ix;
+        if (ix == nodeOf(node)->count) {
+            node = node->next;
+            ix = 0U;
+        }
+        return *this;
+    }
+
+    Iterator& operator--() noexcept {
+        if (ix == 0U) {
+            node = node->prev;
+            ix = nodeOf(node)->count;
+        }
+        --ix;
+        return *this;
+    }
+
+    const Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        operator++();
+        return old;
+    }
+
+    const Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        operator--();
+        return old;
+    }
+
+  private:
+
+    Iterator(Detail::DoubleChain::Node* n, size_type i) noexcept :
+        node(n),
+        ix(i) {}
+};
+
+
+template<class T, std::size_t K>
+void UnrolledList<T, K>::clear() noexcept(noexceptDestroy) {
+
+    while (!chain.isEmpty()) {
+        Node* node = nodeOf(chain.getFirst());
+        T* items = node->items();
+        for (size_type i = 0U; i < node->count; ++i) {
+            items[i].~T();
+        }
+        node->count = 0U;
+        deleteNode(node);
+    }
+
+    size_ = 0U;
+}
+
+
+template<class T, std::size_t K>
+auto UnrolledList<T, K>::makeRoomAt(const_iterator pos) -> std::pair<Node*, size_type> {
+
+    // Appending to the previous node is preferred when inserting to the front of a node.
+    if ((pos.ix == 0U) && isNode(pos.node->prev)) {
+        Node* prev = nodeOf(pos.node->prev);
+        if (prev->count < K) {
+            return std::make_pair(prev, prev->count);
+        }
+    }
+
+    if (!isNode(pos.node)) {
+        Node* created = createNodeBefore(pos.node);
+        return std::make_pair(created, 0U);
+    }
+
+    Node* node = nodeOf(pos.node);
+    size_type ix = pos.ix;
+
+    if (node->count == K) {
+        // Split the full node, the upper half is moved to a new node.
+        Node* created = createNodeBefore(node->next);
+        if (created == nullptr) {
+            return std::make_pair(nullptr, 0U);
+        }
+
+        const size_type keep = K / 2U;
+        relocate(created->items(), node->items() + keep, K - keep);
+        created->count = K - keep;
+        node->count = keep;
+
+        if (ix > keep) {
+            node = created;
+            ix -= keep;
+        }
+    }
+
+    relocate(node->items() + ix + 1U, node->items() + ix, node->count - ix);
+    return std::make_pair(node, ix);
+}
+
+
+template<class T, std::size_t K>
+template<typename... Args>
+auto UnrolledList<T, K>::emplace(const_iterator pos, Args&&... args) -> iterator {
+
+    auto slot = makeRoomAt(pos);
+    if (slot.first == nullptr) {
+        return end();
+    }
+
+    // Closes the gap again if the constructor throws.
+    struct Gap {
+        UnrolledList& list;
+        Node* node;
+        size_type ix;
+        bool open;
+
+        ~Gap() {
+            if (open) {
+                relocate(node->items() + ix, node->items() + ix + 1U, node->count - ix);
+                if (node->count == 0U) {
+                    list.deleteNode(node);
+                }
+            }
+        }
+    } gap {*this, slot.first, slot.second, true};
+
+    new (&slot.first->items()[slot.second]) T(std::forward<Args>(args)...);
+    gap.open = false;
+    ++slot.first->count;
+    ++size_;
+
+    return iterator(slot.first, slot.second);
+}
+
+
+template<class T, std::size_t K>
+auto UnrolledList<T, K>::insert(const_iterator pos, size_type n, const T& item) -> iterator {
+
+    iterator it(pos.node, pos.ix);
+    size_type cnt = 0U;
+    while (cnt < n) {
+        iterator inserted = insert(it, item);
+        if (inserted == end()) {
+            break;
+        }
+        it = inserted;
+        ++it;
+        ++cnt;
+    }
+
+    return rewind(it, cnt);
+}
+
+
+template<class T, std::size_t K>
+template<typename InputIt>
+enable_if_t<Detail::IsInputIterator<InputIt>::value, typename UnrolledList<T, K>::iterator>
+UnrolledList<T, K>::insert(const_iterator pos, InputIt first, InputIt last) {
+
+    iterator it(pos.node, pos.ix);
+    size_type cnt = 0U;
+    while (first != last) {
+        iterator inserted = insert(it, *first);
+        if (inserted == end()) {
+            break;
+        }
+        it = inserted;
+        ++it;
+        ++cnt;
+        ++first;
+    }
+
+    return rewind(it, cnt);
+}
+
+
+template<class T, std::size_t K>
+void UnrolledList<T, K>::mergeWithNext(Node* node) noexcept(noexceptErase) {
+
+    if (isNode(node->next)) {
+        Node* next = nodeOf(node->next);
+        if ((node->count + next->count) <= (K / 2U)) {
+            relocate(node->items() + node->count, next->items(), next->count);
+            node->count += next->count;
+            next->count = 0U;
+            deleteNode(next);
+        }
+    }
+}
+
+
+template<class T, std::size_t K>
+auto UnrolledList<T, K>::erase(const_iterator pos) noexcept(noexceptErase) -> iterator {
+
+    ETL_ASSERT(pos != end());
+
+    Node* node = nodeOf(pos.node);
+    const size_type ix = pos.ix;
+
+    node->items()[ix].~T();
+    relocate(node->items() + ix, node->items() + ix + 1U, node->count - ix - 1U);
+    --node->count;
+    --size_;
+
+    if (node->count == 0U) {
+        auto* next = node->next;
+        deleteNode(node);
+        return iterator(next, 0U);
+    }
+
+    mergeWithNext(node);
+
+    if (ix < node->count) {
+        return iterator(node, ix);
+    } else {
+        return iterator(node->next, 0U);
+    }
+}
+
+
+template<class T, std::size_t K>
+auto UnrolledList<T, K>::erase(const_iterator first, const_iterator last) noexcept(
+    noexceptErase) -> iterator {
+
+    size_type num = 0U;
+    for (const_iterator it = first; it != last; ++it) {
+        ++num;
+    }
+
+    iterator it(first.node, first.ix);
+    while (num > 0U) {
+        it = erase(it);
+        --num;
+    }
+
+    return it;
+}
+
+
+template<class T, std::size_t K>
+template<class P>
+auto UnrolledList<T, K>::remove_if(P pred) -> size_type {
+
+    size_type cnt = 0U;
+    iterator it = begin();
+    while (it != end()) {
+        if (pred(*it)) {
+            it = erase(it);
+            ++cnt;
+        } else {
+            ++it;
+        }
+    }
+
+    return cnt;
+}
+
+
+template<class T, std::size_t K>
+void UnrolledList<T, K>::swap(UnrolledList& other) {
+
+    if (&other == this) {
+        return;
+    }
+
+    if (allocator.handle() == other.allocator.handle()) {
+        swapNodeList(other);
+        return;
+    }
+
+    iterator own = begin();
+    iterator oth = other.begin();
+    while ((own != end()) && (oth != other.end())) {
+        Detail::swapInCont(*own, *oth);
+        ++own;
+        ++oth;
+    }
+
+    auto moveTail = [](UnrolledList& dst, UnrolledList& src, iterator first) {
+        iterator it = first;
+        while ((it != src.end()) && (dst.emplace_back(std::move(*it)) != dst.end())) {
+            ++it;
+        }
+        src.erase(first, it);
+    };
+
+    if (own != end()) {
+        moveTail(other, *this, own);
+    } else if (oth != other.end()) {
+        moveTail(*this, other, oth);
+    }
+}
+
+
+template<class T, std::size_t K>
+bool operator==(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return Detail::isEqual(lhs, rhs);
+}
+
+template<class T, std::size_t K>
+bool operator!=(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return !(lhs == rhs);
+}
+
+template<class T, std::size_t K>
+bool operator<(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return Detail::isLess(lhs, rhs);
+}
+
+template<class T, std::size_t K>
+bool operator<=(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return !(rhs < lhs);
+}
+
+template<class T, std::size_t K>
+bool operator>(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return (rhs < lhs);
+}
+
+template<class T, std::size_t K>
+bool operator>=(const UnrolledList<T, K>& lhs, const UnrolledList<T, K>& rhs) {
+    return !(lhs < rhs);
+}
+
+
+template<class T, std::size_t K>
+void swap(UnrolledList<T, K>& lhs, UnrolledList<T, K>& rhs) {
+    lhs.swap(rhs);
+}
+
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class T, std::size_t K, class P>
+typename UnrolledList<T, K>::size_type erase_if(UnrolledList<T, K>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_UNROLLEDLISTTEMPLATE_H_
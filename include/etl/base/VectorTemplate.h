@@ -186,6 +186,7 @@ class Vector : protected Detail::TypedVectorBase<T> {
     using Base::pop_front;
     using Base::pop_back;
     using Base::erase;
+    using Base::remove_if;
 
     iterator insert(const_iterator position, const_reference value) {
         return emplace(position, value);
@@ -213,18 +214,31 @@ class Vector : protected Detail::TypedVectorBase<T> {
 
     template<typename... Args>
     void emplace_back(Args&&... args) {
-        emplace(this->end(), args...);
+        emplace(this->end(), std::forward<Args>(args)...);
     }
 
     void push_front(const_reference value) {
         insert(this->begin(), value);
     }
 
+    void push_front(value_type&& value) {
+        insert(this->begin(), std::move(value));
+    }
+
     void push_back(const_reference value) {
         insert(this->end(), value);
     }
 
+    void push_back(value_type&& value) {
+        insert(this->end(), std::move(value));
+    }
+
     void swap(Vector& other);
+
+    /// Returns `true` if `swap()` with `other` exchanges the storages instead of the elements.
+    bool swapsStorageWith(const Vector& other) const noexcept {
+        return (strategy.handle() == other.strategy.handle());
+    }
     /// \}
 
   protected:
@@ -235,18 +249,12 @@ class Vector : protected Detail::TypedVectorBase<T> {
     template<typename InputIt>
     iterator
     insertRange(const_iterator position, InputIt first, InputIt last, std::forward_iterator_tag) {
+        // The length of a forward range is known in advance: storage is reserved
+        // once and the elements are constructed in place.
+        typename Base::template ContCreator<InputIt> cc {first, last};
 #if ETL_VEC_INSERT_WITH_SNR
-        auto numToInsert = std::distance(first, last);
-        if (numToInsert > 0) {
-            auto res = prepareForInsert(position, numToInsert);
-            if (res.first) {
-                position = insertRangeWithSNR(res.second, first, last);
-            }
-        }
-
-        return iterator(position);
+        return insertWithCreatorAndSNR(position, cc.getLength(), cc);
 #else
-        typename Base::template ContCreator<InputIt> cc {first, last};
         return insertWithCreator(position, cc.getLength(), cc);
 #endif
     }
@@ -276,6 +284,11 @@ class Vector : protected Detail::TypedVectorBase<T> {
     iterator insertRangeWithSNR(const_iterator position, InputIt first, InputIt last) noexcept(
         is_nothrow_move_assignable<T>::value&& is_nothrow_move_constructible<T>::value);
 
+    template<class CR>
+    iterator insertWithCreatorAndSNR(const_iterator position,
+                                     size_type numToInsert,
+                                     const CR& creatorCall);
+
 
     friend bool operator==(const Vector& lhs, const Vector& rhs) {
         return Detail::isEqual(lhs, rhs);
@@ -390,6 +403,30 @@ auto Vector<T>::insertRangeWithSNR(const_iterator position, InputIt first, Input
 }
 
 
+template<class T>
+template<class CR>
+auto Vector<T>::insertWithCreatorAndSNR(const_iterator position,
+                                        size_type numToInsert,
+                                        const CR& creatorCall) -> iterator {
+
+    // Same ordering as insertRangeWithSNR(), but the whole range is
+    // appended with a single reservation before the rotation.
+
+    if (numToInsert > 0) {
+        auto res = prepareForInsert(position, numToInsert);
+        if (res.first) {
+            auto posIndex = std::distance(cbegin(), res.second);
+            auto origSize = size();
+            Base::insertOperation(cend(), numToInsert, creatorCall);
+            Base::swapNeighbourRanges(posIndex, origSize);
+            return Base::getIterator(posIndex);
+        }
+    }
+
+    return iterator(position);
+}
+
+
 template<class T>
 void Vector<T>::swap(Vector<T>& other) {
 
@@ -452,9 +489,9 @@ auto Vector<T>::emplace(const_iterator position, Args&&... args) -> iterator {
 
         return Base::insertOneOperation(res.second, [&args...](pointer item, bool place) {
             if (place) {
-                new (item) T(args...);
+                new (item) T(std::forward<Args>(args)...);
             } else {
-                *item = T(args...);
+                *item = T(std::forward<Args>(args)...);
             }
         });
 
@@ -668,6 +705,13 @@ class Vector<T*> : public Vector<typename Detail::CopyConst<T, void>::Type*> {
             Base::erase(reinterpret_cast<typename Base::iterator>(first),
                         reinterpret_cast<typename Base::iterator>(last)));
     }
+
+    template<class P>
+    size_type remove_if(P pred) {
+        return Base::remove_if([&pred](typename Base::reference item) {
+            return pred(reinterpret_cast<reference>(item));
+        });
+    }
     /// \}
 
   protected:
@@ -732,6 +776,14 @@ class Vector<T*> : public Vector<typename Detail::CopyConst<T, void>::Type*> {
     }
 };
 
+
+/// Erases all elements satisfying `pred` in one pass.
+/// \return the number of erased elements.
+template<class T, class P>
+typename Vector<T>::size_type erase_if(Vector<T>& cont, P pred) {
+    return cont.remove_if(pred);
+}
+
 }  // namespace ETL_NAMESPACE
 
 
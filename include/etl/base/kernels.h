@@ -0,0 +1,270 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#ifndef ETL_KERNELS_H_
+#define ETL_KERNELS_H_
+
+#include <etl/etlSupport.h>
+#include <etl/traitSupport.h>
+
+#include <cstring>
+
+namespace ETL_NAMESPACE {
+namespace Detail {
+
+/*
+Element kernels over contiguous ranges.
+
+The kernels are written as plain loops over raw pointers in fixed-size blocks,
+without early exits inside a block. This shape is vectorized by the compiler
+for the actual target (SSE/AVX, NEON, etc.) on optimized builds, while it stays
+portable scalar code otherwise. Byte-wise equality, mismatch and byte search are
+forwarded to `memcmp()` and `memchr()`, which are typically vectorized and
+dispatched at runtime by the C library.
+*/
+
+/// Number of elements processed in one block by the kernels.
+constexpr std::size_t KERNEL_BLOCK {32U};
+
+
+/// Types whose equality is equivalent to the equality of their object representation.
+template<class T>
+struct IsTriviallyComparable {
+    static constexpr bool value = is_integral<T>::value || is_enum<T>::value
+                                  || is_pointer<T>::value;
+};
+
+
+/// Types handled by the arithmetic kernels.
+template<class T>
+struct UseArithmeticKernel {
+    static constexpr bool value = is_arithmetic<T>::value || is_pointer<T>::value
+                                  || is_enum<T>::value;
+};
+
+
+template<class C, class Enable = void>
+struct IsContiguous : std::false_type {};
+
+/// Containers exposing their elements as one array via `data()` and `size()`,
+/// e.g. `Vector`, `Span`, `std::array` and `std::vector`.
+template<class C>
+struct IsContiguous<
+    C,
+    enable_if_t<is_convertible<decltype(std::declval<const C&>().data()),
+                               const typename C::value_type*>::value
+                && is_convertible<decltype(std::declval<const C&>().size()), std::size_t>::value>>
+    : std::true_type {};
+
+
+template<class T>
+enable_if_t<IsTriviallyComparable<T>::value, bool>
+equalKernel(const T* lhs, const T* rhs, std::size_t n) noexcept {
+    return (n == 0U) || (std::memcmp(lhs, rhs, n * sizeof(T)) == 0);
+}
+
+template<class T>
+enable_if_t<!IsTriviallyComparable<T>::value, bool>
+equalKernel(const T* lhs, const T* rhs, std::size_t n) {
+
+    bool eq = true;
+    for (std::size_t i = 0U; eq && (i < n); ++i) {
+        eq = (lhs[i] == rhs[i]);
+    }
+
+    return eq;
+}
+
+
+/// Returns the index of the first element differing in the two ranges, or `n`.
+template<class T>
+enable_if_t<IsTriviallyComparable<T>::value, std::size_t>
+mismatchKernel(const T* lhs, const T* rhs, std::size_t n) noexcept {
+
+    std::size_t i = 0U;
+    const std::size_t blockBytes = KERNEL_BLOCK * sizeof(T);
+    while (((n - i) >= KERNEL_BLOCK) && (std::memcmp(lhs + i, rhs + i, blockBytes) == 0)) {
+        i += KERNEL_BLOCK;
+    }
+
+    while ((i < n) && (lhs[i] == rhs[i])) {
+        ++i;
+    }
+
+    return i;
+}
+
+template<class T>
+enable_if_t<!IsTriviallyComparable<T>::value, std::size_t>
+mismatchKernel(const T* lhs, const T* rhs, std::size_t n) {
+
+    std::size_t i = 0U;
+    while ((i < n) && (lhs[i] == rhs[i])) {
+        ++i;
+    }
+
+    return i;
+}
+
+
+/// Returns the index of the first element equal to `value`, or `n`.
+template<class T>
+enable_if_t<IsTriviallyComparable<T>::value && (sizeof(T) == 1U), std::size_t>
+findKernel(const T* data, std::size_t n, const T& value) noexcept {
+
+    unsigned char byte;
+    std::memcpy(&byte, &value, 1U);
+
+    const void* found = (n > 0U) ? std::memchr(data, byte, n) : nullptr;
+    return (found != nullptr) ? static_cast<std::size_t>(static_cast<const T*>(found) - data) : n;
+}
+
+template<class T>
+enable_if_t<UseArithmeticKernel<T>::value
+                && !(IsTriviallyComparable<T>::value && (sizeof(T) == 1U)),
+            std::size_t>
+findKernel(const T* data, std::size_t n, const T& value) noexcept {
+
+    const T v = value;
+    std::size_t i = 0U;
+
+    for (; (n - i) >= KERNEL_BLOCK; i += KERNEL_BLOCK) {
+        bool any = false;
+        for (std::size_t j = 0U; j < KERNEL_BLOCK; ++j) {
+            any |= (data[i + j] == v);
+        }
+        if (any) {
+            break;
+        }
+    }
+
+    while ((i < n) && !(data[i] == v)) {
+        ++i;
+    }
+
+    return i;
+}
+
+template<class T>
+enable_if_t<!UseArithmeticKernel<T>::value, std::size_t>
+findKernel(const T* data, std::size_t n, const T& value) {
+
+    std::size_t i = 0U;
+    while ((i < n) && !(data[i] == value)) {
+        ++i;
+    }
+
+    return i;
+}
+
+
+template<class T>
+enable_if_t<UseArithmeticKernel<T>::value, std::size_t>
+countKernel(const T* data, std::size_t n, const T& value) noexcept {
+
+    const T v = value;
+    std::size_t cnt = 0U;
+    for (std::size_t i = 0U; i < n; ++i) {
+        cnt += (data[i] == v) ? 1U : 0U;
+    }
+
+    return cnt;
+}
+
+template<class T>
+enable_if_t<!UseArithmeticKernel<T>::value, std::size_t>
+countKernel(const T* data, std::size_t n, const T& value) {
+
+    std::size_t cnt = 0U;
+    for (std::size_t i = 0U; i < n; ++i) {
+        if (data[i] == value) {
+            ++cnt;
+        }
+    }
+
+    return cnt;
+}
+
+
+/// Returns the index of the first smallest element, or `n` for empty ranges.
+/// Integral types use a branchless reduction first, then locate the result.
+template<class T>
+enable_if_t<is_integral<T>::value, std::size_t> minKernel(const T* data, std::size_t n) noexcept {
+
+    if (n == 0U) {
+        return n;
+    }
+
+    T m = data[0];
+    for (std::size_t i = 1U; i < n; ++i) {
+        m = (data[i] < m) ? data[i] : m;
+    }
+
+    return findKernel(data, n, m);
+}
+
+template<class T>
+enable_if_t<!is_integral<T>::value, std::size_t> minKernel(const T* data, std::size_t n) {
+
+    std::size_t ix = 0U;
+    for (std::size_t i = 1U; i < n; ++i) {
+        if (data[i] < data[ix]) {
+            ix = i;
+        }
+    }
+
+    return (n > 0U) ? ix : n;
+}
+
+
+/// Returns the index of the first largest element, or `n` for empty ranges.
+template<class T>
+enable_if_t<is_integral<T>::value, std::size_t> maxKernel(const T* data, std::size_t n) noexcept {
+
+    if (n == 0U) {
+        return n;
+    }
+
+    T m = data[0];
+    for (std::size_t i = 1U; i < n; ++i) {
+        m = (m < data[i]) ? data[i] : m;
+    }
+
+    return findKernel(data, n, m);
+}
+
+template<class T>
+enable_if_t<!is_integral<T>::value, std::size_t> maxKernel(const T* data, std::size_t n) {
+
+    std::size_t ix = 0U;
+    for (std::size_t i = 1U; i < n; ++i) {
+        if (data[ix] < data[i]) {
+            ix = i;
+        }
+    }
+
+    return (n > 0U) ? ix : n;
+}
+
+}  // namespace Detail
+}  // namespace ETL_NAMESPACE
+
+#endif  // ETL_KERNELS_H_
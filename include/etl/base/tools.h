@@ -22,10 +22,13 @@ limitations under the License.
 #ifndef ETL_TOOLS_H_
 #define ETL_TOOLS_H_
 
+#include <etl/base/kernels.h>
 #include <etl/etlSupport.h>
 #include <etl/traitSupport.h>
 
 #include <iterator>
+#include <new>
+#include <utility>
 
 namespace ETL_NAMESPACE {
 namespace Detail {
@@ -51,6 +54,42 @@ template<class T>
 struct HasValueType<T, typename TypeDefined<typename T::value_type>::type> : std::true_type {};
 
 
+/// Compile-time index list, the C++11 replacement of `std::index_sequence`.
+template<std::size_t... Is>
+struct IndexSequence {};
+
+template<std::size_t N, std::size_t... Is>
+struct MakeIndexSequence : MakeIndexSequence<N - 1U, N - 1U, Is...> {};
+
+template<std::size_t... Is>
+struct MakeIndexSequence<0U, Is...> {
+    using Type = IndexSequence<Is...>;
+};
+
+
+template<class L, class R>
+enable_if_t<IsContiguous<L>::value && IsContiguous<R>::value, bool>
+isEqualElements(const L& lhs, const R& rhs) {
+    return equalKernel(lhs.data(), rhs.data(), lhs.size());
+}
+
+template<class L, class R>
+enable_if_t<!(IsContiguous<L>::value && IsContiguous<R>::value), bool>
+isEqualElements(const L& lhs, const R& rhs) {
+
+    bool eq = true;
+    auto lIt = lhs.begin();
+    auto rIt = rhs.begin();
+    while (eq && (lIt != lhs.end())) {
+        eq = (*lIt == *rIt);
+        ++lIt;
+        ++rIt;
+    }
+
+    return eq;
+}
+
+
 template<class L,
          class R,
          typename = enable_if_t<HasValueType<L>::value && HasValueType<R>::value>,
@@ -62,18 +101,42 @@ bool isEqual(const L& lhs, const R& rhs) {
     } else if (lhs.size() != rhs.size()) {
         return false;
     } else {
+        return isEqualElements(lhs, rhs);
+    }
+}
 
-        bool eq = true;
-        auto lIt = lhs.begin();
-        auto rIt = rhs.begin();
-        while (eq && (lIt != lhs.end())) {
-            eq = (*lIt == *rIt);
-            ++lIt;
-            ++rIt;
-        }
 
-        return eq;
+template<class L, class R>
+using UseLessKernel = integral_constant<bool,
+                                        IsContiguous<L>::value && IsContiguous<R>::value
+                                            && IsTriviallyComparable<typename L::value_type>::value>;
+
+template<class L, class R>
+enable_if_t<UseLessKernel<L, R>::value, bool> isLessElements(const L& lhs, const R& rhs) {
+
+    const auto* l = lhs.data();
+    const auto* r = rhs.data();
+    const std::size_t n = lhs.size();
+    const std::size_t ix = mismatchKernel(l, r, n);
+
+    return (ix < n) && (l[ix] < r[ix]);
+}
+
+template<class L, class R>
+enable_if_t<!UseLessKernel<L, R>::value, bool> isLessElements(const L& lhs, const R& rhs) {
+
+    bool less = false;
+    bool greater = false;
+    auto lIt = lhs.begin();
+    auto rIt = rhs.begin();
+    while ((!less) && (!greater) && (lIt != lhs.end())) {
+        less = (*lIt < *rIt);
+        greater = (*lIt > *rIt);
+        ++lIt;
+        ++rIt;
     }
+
+    return less;
 }
 
 
@@ -90,19 +153,7 @@ bool isLess(const L& lhs, const R& rhs) {
     } else if (lhs.size() > rhs.size()) {
         return false;
     } else {
-
-        bool less = false;
-        bool greater = false;
-        auto lIt = lhs.begin();
-        auto rIt = rhs.begin();
-        while ((!less) && (!greater) && (lIt != lhs.end())) {
-            less = (*lIt < *rIt);
-            greater = (*lIt > *rIt);
-            ++lIt;
-            ++rIt;
-        }
-
-        return less;
+        return isLessElements(lhs, rhs);
     }
 }
 
@@ -235,6 +286,24 @@ struct UseSwapInCont<std::pair<const K, E>> {
 };
 
 
+/// Swaps two elements of containers with `swap()` when `UseSwapInCont` allows it.
+template<typename T>
+enable_if_t<UseSwapInCont<T>::value> swapInCont(T& lhs, T& rhs) {
+    using std::swap;
+    swap(lhs, rhs);
+}
+
+/// Swaps two elements of containers by reconstruction when `swap()` is not applicable.
+template<typename T>
+enable_if_t<!UseSwapInCont<T>::value> swapInCont(T& lhs, T& rhs) {
+    T tmp(std::move(lhs));
+    lhs.~T();
+    new (&lhs) T(std::move(rhs));
+    rhs.~T();
+    new (&rhs) T(std::move(tmp));
+}
+
+
 class NullLock {
   public:  // functions
     void lock() noexcept {}
@@ -242,6 +311,10 @@ class NullLock {
 };
 
 
+/// Tag to construct LockGuard for a lock already taken.
+struct AdoptLock {};
+
+
 template<class L>
 class LockGuard {
 
@@ -256,6 +329,9 @@ class LockGuard {
         l->lock();
     }
 
+    LockGuard(L& toLock, AdoptLock) noexcept :
+        l {&toLock} {}
+
     LockGuard() = delete;
     LockGuard(const LockGuard& other) = delete;
     LockGuard& operator=(const LockGuard& other) & = delete;
@@ -279,6 +355,31 @@ LockGuard<L> lock(L& toLock) noexcept(noexcept(LockGuard<L> {toLock})) {
     return LockGuard<L> {toLock};
 }
 
+
+template<class L, class Enable = void>
+struct HasTryLock : std::false_type {};
+
+template<class L>
+struct HasTryLock<L, decltype((void)std::declval<L&>().try_lock())> : std::true_type {};
+
+/// Locks `toLock`, incrementing `cnt` when the lock was found taken.
+/// The counter is updated with the lock held.
+template<class L>
+enable_if_t<HasTryLock<L>::value, LockGuard<L>> lockCounted(L& toLock, std::size_t& cnt) {
+    if (!toLock.try_lock()) {
+        toLock.lock();
+        ++cnt;
+    }
+    return LockGuard<L> {toLock, AdoptLock {}};
+}
+
+template<class L>
+enable_if_t<!HasTryLock<L>::value, LockGuard<L>>
+lockCounted(L& toLock, std::size_t& cnt) noexcept(noexcept(LockGuard<L> {toLock})) {
+    (void)cnt;
+    return LockGuard<L> {toLock};
+}
+
 }  // namespace Detail
 }  // namespace ETL_NAMESPACE
 
@@ -47,6 +47,18 @@ limitations under the License.
 #define ETL_DISABLE_ASSERT 0
 #endif
 
+/// Per-thread cache size of the common pool allocators used by `Pooled` containers,
+/// `0` disables the caches.
+#ifndef ETL_POOL_THREAD_CACHE
+#define ETL_POOL_THREAD_CACHE 0
+#endif
+
+/// Enables the usage counters of the pools, see PoolStats.
+/// Has to be the same for the library and the user code.
+#ifndef ETL_POOL_STATS
+#define ETL_POOL_STATS 0
+#endif
+
 
 // Assertions
 
@@ -27,6 +27,12 @@ list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/SingleChain.cpp)
 list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/DoubleChain.cpp)
 list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/FifoIndexing.cpp)
 list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/PoolBase.cpp)
+list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/AtomicPoolBase.cpp)
+list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/BitmapPoolBase.cpp)
+list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/OffsetPoolBase.cpp)
+list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/PoolRegistry.cpp)
+list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/SlabBase.cpp)
+list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/MonotonicArena.cpp)
 list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/BufStr.cpp)
 list(APPEND ETL_SRCS ${ETL_SRCS_DIR}/AHashTable.cpp)
 
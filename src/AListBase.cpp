@@ -60,15 +60,32 @@ void AListBase::splice(Iterator pos,
                        Iterator first,
                        Iterator last) noexcept {
 
-    if (&other != this) {
-
-        Iterator item = first;
-        while (item != last) {
+    if ((first == other.begin()) && (last == other.end())) {
+        splice(pos, other, first, last, other.size_);
+    } else {
 
-            Iterator next = item;
-            ++next;
-            insert(pos, *other.remove(item));
-            item = next;
+        size_type num = 0U;
+        for (Iterator it = first; it != last; ++it) {
+            ++num;
         }
+
+        splice(pos, other, first, last, num);
+    }
+}
+
+
+void AListBase::splice(Iterator pos,
+                       AListBase& other,
+                       Iterator first,
+                       Iterator last,
+                       size_type num) noexcept {
+
+    if ((&other != this) && (num > 0U)) {
+
+        ETL_ASSERT(other.size_ >= num);
+
+        chain.splice(pos.node, first.node, last.node);
+        other.size_ -= num;
+        size_ += num;
     }
 }
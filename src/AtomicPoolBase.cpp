@@ -0,0 +1,149 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <etl/base/AtomicPoolBase.h>
+
+using ETL_NAMESPACE::Detail::AtomicPoolBase;
+
+
+constexpr std::uint64_t AtomicPoolBase::LINK_MASK;
+constexpr std::uint64_t AtomicPoolBase::TAG_INC;
+
+
+void* AtomicPoolBase::popReleased() noexcept {
+
+    std::uint64_t old = head.load(std::memory_order_acquire);
+
+    while ((old & LINK_MASK) != 0U) {
+
+        const Link ix = static_cast<Link>(old & LINK_MASK) - 1U;
+        const std::uint64_t next = links[ix].load(std::memory_order_relaxed);
+        const std::uint64_t desired = ((old & ~LINK_MASK) + TAG_INC) | next;
+
+        if (head.compare_exchange_weak(old,
+                                       desired,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+            return data.getItemPointer(ix);
+        }
+    }
+
+    return nullptr;
+}
+
+
+void* AtomicPoolBase::pop() noexcept {
+
+    void* result = popReleased();
+
+    if ((result == nullptr) && (nextFreeIx.load(std::memory_order_relaxed) < data.size())) {
+        const std::size_t ix = nextFreeIx.fetch_add(1U, std::memory_order_relaxed);
+        if (ix < data.size()) {
+            result = data.getItemPointer(ix);
+        }
+    }
+
+    if (result != nullptr) {
+        freeCnt.fetch_sub(1U, std::memory_order_relaxed);
+    }
+
+#if ETL_POOL_STATS
+    countPop(result != nullptr);
+#endif
+
+    return result;
+}
+
+
+bool AtomicPoolBase::push(void* item) noexcept {
+
+    const uint8_t* const itemEnd = static_cast<uint8_t*>(item) + data.getItemSize();
+    const uint8_t* const regionStart = static_cast<uint8_t*>(data.getItemPointer(0));
+    const uint8_t* const regionEnd = static_cast<uint8_t*>(data.getItemPointer(data.size()));
+
+    if ((item < regionStart) || (itemEnd > regionEnd)) {
+        return false;
+    }
+
+    const auto offset = static_cast<std::size_t>(static_cast<uint8_t*>(item) - regionStart);
+    const auto link = static_cast<Link>(offset / data.getItemSize()) + 1U;
+
+    std::uint64_t old = head.load(std::memory_order_relaxed);
+    std::uint64_t desired = 0U;
+
+    do {
+        links[link - 1U].store(static_cast<Link>(old & LINK_MASK), std::memory_order_relaxed);
+        desired = ((old & ~LINK_MASK) + TAG_INC) | link;
+    } while (!head.compare_exchange_weak(old,
+                                         desired,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+
+    freeCnt.fetch_add(1U, std::memory_order_relaxed);
+#if ETL_POOL_STATS
+    frees.fetch_add(1U, std::memory_order_relaxed);
+#endif
+    return true;
+}
+
+
+void AtomicPoolBase::reset() noexcept {
+
+#if ETL_POOL_STATS
+    frees.fetch_add(data.size() - freeCnt.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+#endif
+
+    const std::uint64_t old = head.load(std::memory_order_relaxed);
+    head.store((old & ~LINK_MASK) + TAG_INC, std::memory_order_release);
+    nextFreeIx.store(0U, std::memory_order_relaxed);
+    freeCnt.store(data.size(), std::memory_order_relaxed);
+}
+
+
+#if ETL_POOL_STATS
+void AtomicPoolBase::countPop(bool success) noexcept {
+
+    if (success) {
+        allocations.fetch_add(1U, std::memory_order_relaxed);
+        const std::size_t cnt = data.size() - freeCnt.load(std::memory_order_relaxed);
+        std::size_t hw = highWater.load(std::memory_order_relaxed);
+        while ((cnt > hw)
+               && !highWater.compare_exchange_weak(hw, cnt, std::memory_order_relaxed)) {}
+    } else {
+        failures.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+#endif
+
+
+ETL_NAMESPACE::PoolStats AtomicPoolBase::getStats() const noexcept {
+
+    PoolStats stats {};
+#if ETL_POOL_STATS
+    stats.highWater = highWater.load(std::memory_order_relaxed);
+    stats.failures = failures.load(std::memory_order_relaxed);
+    stats.allocations = allocations.load(std::memory_order_relaxed);
+    stats.frees = frees.load(std::memory_order_relaxed);
+#endif
+    return stats;
+}
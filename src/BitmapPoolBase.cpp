@@ -0,0 +1,243 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <etl/base/BitmapPoolBase.h>
+
+using ETL_NAMESPACE::Detail::BitmapPoolBase;
+
+
+constexpr std::size_t BitmapPoolBase::WORD_BITS;
+
+
+namespace {
+
+using Word = BitmapPoolBase::Word;
+
+/// \pre `w != 0`
+std::size_t countTrailingZeros(Word w) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(w));
+#else
+    std::size_t cnt = 0U;
+    while ((w & 1U) == 0U) {
+        w >>= 1U;
+        ++cnt;
+    }
+    return cnt;
+#endif
+}
+
+std::size_t popCount(Word w) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(w));
+#else
+    std::size_t cnt = 0U;
+    while (w != 0U) {
+        w &= (w - 1U);
+        ++cnt;
+    }
+    return cnt;
+#endif
+}
+
+/// Mask of `len` bits from bit `b`.
+Word rangeMask(std::size_t b, std::size_t len) noexcept {
+    const Word bits = (len < BitmapPoolBase::WORD_BITS) ? ((Word {1U} << len) - 1U) : ~Word {0U};
+    return bits << b;
+}
+
+/// Calls `f(wordIx, mask)` for the words covering the `n` bits from `ix`.
+template<class F>
+void forRange(std::size_t ix, std::size_t n, F f) {
+
+    const std::size_t end = ix + n;
+    while (ix < end) {
+        const std::size_t b = ix % BitmapPoolBase::WORD_BITS;
+        const std::size_t rem = BitmapPoolBase::WORD_BITS - b;
+        const std::size_t len = (rem < (end - ix)) ? rem : (end - ix);
+        f(ix / BitmapPoolBase::WORD_BITS, rangeMask(b, len));
+        ix += len;
+    }
+}
+
+}  // namespace
+
+
+void* BitmapPoolBase::pop() noexcept {
+
+    void* result = nullptr;
+
+    if (freeCnt > 0U) {
+        const std::size_t ix = findFree(firstFreeWord * WORD_BITS);
+        if (ix < data.size()) {
+            mark(ix, 1U, true);
+            firstFreeWord = ix / WORD_BITS;
+            result = data.getItemPointer(ix);
+        }
+    }
+
+    countPop(result, 1U);
+    return result;
+}
+
+
+void* BitmapPoolBase::pop(std::size_t n) noexcept {
+
+    void* result = nullptr;
+
+    if ((n > 0U) && (n <= freeCnt)) {
+        std::size_t ix = findFree(firstFreeWord * WORD_BITS);
+        while ((ix < data.size()) && (n <= (data.size() - ix))) {
+            const std::size_t end = findUsed(ix);
+            if ((end - ix) >= n) {
+                mark(ix, n, true);
+                result = data.getItemPointer(ix);
+                break;
+            }
+            ix = findFree(end);
+        }
+    }
+
+    countPop(result, n);
+    return result;
+}
+
+
+bool BitmapPoolBase::push(void* item, std::size_t n) noexcept {
+
+    const std::size_t ix = usedRunIndex(item, n);
+    if (ix >= data.size()) {
+        return false;
+    }
+
+    mark(ix, n, false);
+    if ((ix / WORD_BITS) < firstFreeWord) {
+        firstFreeWord = ix / WORD_BITS;
+    }
+
+#if ETL_POOL_STATS
+    stats.frees += n;
+#endif
+
+    return true;
+}
+
+
+void BitmapPoolBase::reset() noexcept {
+
+#if ETL_POOL_STATS
+    stats.frees += data.size() - freeCnt;
+#endif
+
+    for (std::size_t w = 0U; w < wordCount(data.size()); ++w) {
+        bitmap[w] = 0U;
+    }
+
+    freeCnt = data.size();
+    firstFreeWord = 0U;
+}
+
+
+std::size_t BitmapPoolBase::find(std::size_t ix, Word skip) const noexcept {
+
+    const std::size_t n = data.size();
+    if (ix >= n) {
+        return n;
+    }
+
+    std::size_t w = ix / WORD_BITS;
+    Word bits = (bitmap[w] ^ skip) & (~Word {0U} << (ix % WORD_BITS));
+    while (bits == 0U) {
+        ++w;
+        if (w >= wordCount(n)) {
+            return n;
+        }
+        bits = bitmap[w] ^ skip;
+    }
+
+    // Padding bits of the last word are never used, the result is clamped
+    const std::size_t res = (w * WORD_BITS) + countTrailingZeros(bits);
+    return (res < n) ? res : n;
+}
+
+
+void BitmapPoolBase::mark(std::size_t ix, std::size_t n, bool used) noexcept {
+
+    Word* bm = bitmap;
+    forRange(ix, n, [bm, used](std::size_t w, Word mask) {
+        if (used) {
+            bm[w] |= mask;
+        } else {
+            bm[w] &= ~mask;
+        }
+    });
+
+    if (used) {
+        freeCnt -= n;
+    } else {
+        freeCnt += n;
+    }
+}
+
+
+std::size_t BitmapPoolBase::usedRunIndex(void* item, std::size_t n) const noexcept {
+
+    const std::size_t fail = data.size();
+    const uint8_t* const ptr = static_cast<uint8_t*>(item);
+    const uint8_t* const regionStart = static_cast<const uint8_t*>(data.getItemPointer(0U));
+
+    if ((n == 0U) || (ptr < regionStart)) {
+        return fail;
+    }
+
+    const auto offset = static_cast<std::size_t>(ptr - regionStart);
+    const std::size_t ix = offset / data.getItemSize();
+    if (((offset % data.getItemSize()) != 0U) || (ix >= data.size())
+        || (n > (data.size() - ix))) {
+        return fail;
+    }
+
+    std::size_t usedCnt = 0U;
+    const Word* bm = bitmap;
+    forRange(ix, n, [bm, &usedCnt](std::size_t w, Word mask) {
+        usedCnt += popCount(bm[w] & mask);
+    });
+
+    return (usedCnt == n) ? ix : fail;
+}
+
+
+void BitmapPoolBase::countPop(void* result, std::size_t n) noexcept {
+
+#if ETL_POOL_STATS
+    if (result != nullptr) {
+        stats.allocations += n;
+        const std::size_t cnt = data.size() - freeCnt;
+        stats.highWater = (cnt > stats.highWater) ? cnt : stats.highWater;
+    } else {
+        ++stats.failures;
+    }
+#else
+    (void)result;
+    (void)n;
+#endif
+}
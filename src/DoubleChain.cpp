@@ -80,6 +80,75 @@ void DoubleChain::replace(Node* n1, Node* n2) noexcept {
 }
 
 
+void DoubleChain::splice(Node* pos, Node* first, Node* last) noexcept {
+
+    ETL_ASSERT(pos != nullptr);
+    ETL_ASSERT(pos != &frontNode);
+    ETL_ASSERT(first != nullptr);
+    ETL_ASSERT(last != nullptr);
+
+    if ((first != last) && (pos != first) && (pos != last)) {
+
+        Node* before = first->prev;
+        Node* lastIncluded = last->prev;
+        Node* posPrev = pos->prev;
+
+        linkNodes(before, last);
+        linkNodes(posPrev, first);
+        linkNodes(lastIncluded, pos);
+    }
+}
+
+
+DoubleChain::Node* DoubleChain::detach() noexcept {
+
+    if (isEmpty()) {
+        return nullptr;
+    }
+
+    Node* first = getFirst();
+    getLast()->next = nullptr;
+    setEmpty();
+
+    return first;
+}
+
+
+void DoubleChain::attach(Node* first) noexcept {
+
+    Node* prev = getLast();
+    while (first != nullptr) {
+        Node* next = first->next;
+        linkNodes(prev, first);
+        prev = first;
+        first = next;
+    }
+
+    linkNodes(prev, &backNode);
+}
+
+
+void DoubleChain::reverse() noexcept {
+
+    if (!isEmpty()) {
+
+        Node* first = getFirst();
+        Node* last = getLast();
+
+        Node* node = first;
+        while (node != &backNode) {
+            Node* next = node->next;
+            node->next = node->prev;
+            node->prev = next;
+            node = next;
+        }
+
+        linkNodes(&frontNode, last);
+        linkNodes(first, &backNode);
+    }
+}
+
+
 void DoubleChain::setEmpty() noexcept {
 
     frontNode.next = &backNode;
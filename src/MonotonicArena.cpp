@@ -0,0 +1,108 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <etl/MonotonicArena.h>
+
+#include <cstdint>
+
+using ETL_NAMESPACE::MonotonicArena;
+
+
+bool MonotonicArena::addBuffer(void* buffer, std::size_t size) noexcept {
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(buffer);
+    const std::size_t pad = (alignof(Chunk) - (addr % alignof(Chunk))) % alignof(Chunk);
+
+    if ((buffer == nullptr) || (size <= (pad + sizeof(Chunk)))) {
+        return false;
+    }
+
+    Chunk* chunk = reinterpret_cast<Chunk*>(static_cast<uint8_t*>(buffer) + pad);
+    chunk->next = nullptr;
+    chunk->end = static_cast<uint8_t*>(buffer) + size;
+
+    if (last != nullptr) {
+        last->next = chunk;
+    } else {
+        first = chunk;
+        current = chunk;
+        pos = dataOf(chunk);
+    }
+
+    last = chunk;
+    cap += static_cast<std::size_t>(chunk->end - dataOf(chunk));
+    return true;
+}
+
+
+void* MonotonicArena::allocate(std::size_t size, std::size_t align) noexcept {
+
+    ETL_ASSERT((align > 0U) && ((align & (align - 1U)) == 0U));
+
+    while (current != nullptr) {
+
+        const auto addr = reinterpret_cast<std::uintptr_t>(pos);
+        const std::size_t pad = (align - (addr % align)) % align;
+        const auto left = static_cast<std::size_t>(current->end - pos);
+
+        if ((pad <= left) && (size <= (left - pad))) {
+            uint8_t* result = pos + pad;
+            pos = result + size;
+            used += pad + size;
+            return result;
+        }
+
+        if (current->next == nullptr) {
+            break;
+        }
+
+        used += left;
+        current = current->next;
+        pos = dataOf(current);
+    }
+
+    return nullptr;
+}
+
+
+void MonotonicArena::reset() noexcept {
+
+    current = first;
+    pos = (first != nullptr) ? dataOf(first) : nullptr;
+    used = 0U;
+    ++resets;
+}
+
+
+std::size_t MonotonicArena::available() const noexcept {
+
+    if (current == nullptr) {
+        return 0U;
+    }
+
+    std::size_t cnt = static_cast<std::size_t>(current->end - pos);
+    for (Chunk* c = current->next; c != nullptr; c = c->next) {
+        cnt += static_cast<std::size_t>(c->end - dataOf(c));
+    }
+
+    return cnt;
+}
@@ -0,0 +1,93 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <etl/base/OffsetPoolBase.h>
+
+#include <new>
+
+using ETL_NAMESPACE::Detail::OffsetPoolBase;
+
+
+OffsetPoolBase::OffsetPoolBase(void* d, std::size_t is, std::size_t n) noexcept :
+    data {static_cast<std::uint8_t*>(d)},
+    itemSize {is},
+    size_ {n},
+    freeList {},
+    freeCnt {n},
+    nextFreeIx {0U} {
+
+    ETL_ASSERT(d != nullptr);
+    ETL_ASSERT(is >= sizeof(FreeItem));
+    ETL_ASSERT((is % alignof(FreeItem)) == 0U);
+}
+
+
+void* OffsetPoolBase::pop() noexcept {
+
+    void* result = nullptr;
+
+    if (freeList) {
+
+        FreeItem* item = freeList.get();
+        freeList = item->next;
+        result = item;
+        --freeCnt;
+
+    } else if (nextFreeIx < size_) {
+
+        result = data.get() + (nextFreeIx * itemSize);
+        ++nextFreeIx;
+        --freeCnt;
+
+    } else {
+        // NOP
+    }
+
+    return result;
+}
+
+
+bool OffsetPoolBase::push(void* item) noexcept {
+
+    const std::uint8_t* const ptr = static_cast<std::uint8_t*>(item);
+    const std::uint8_t* const regionStart = data.get();
+    const std::uint8_t* const regionEnd = regionStart + (size_ * itemSize);
+
+    if ((ptr < regionStart) || ((ptr + itemSize) > regionEnd)) {
+        return false;
+    }
+
+    FreeItem* alias = new (item) FreeItem {};
+    alias->next = freeList;
+    freeList = alias;
+    ++freeCnt;
+
+    return true;
+}
+
+
+void OffsetPoolBase::reset() noexcept {
+
+    freeList = nullptr;
+    freeCnt = size_;
+    nextFreeIx = 0U;
+}
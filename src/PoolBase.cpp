@@ -44,6 +44,16 @@ void* PoolBase::pop() noexcept {
         // NOP
     }
 
+#if ETL_POOL_STATS
+    if (result != nullptr) {
+        ++stats.allocations;
+        const std::size_t cnt = data.size() - freeCnt;
+        stats.highWater = (cnt > stats.highWater) ? cnt : stats.highWater;
+    } else {
+        ++stats.failures;
+    }
+#endif
+
     return result;
 }
 
@@ -63,6 +73,10 @@ bool PoolBase::push(void* item) noexcept {
         freeList.next = alias;
         ++freeCnt;
 
+#if ETL_POOL_STATS
+        ++stats.frees;
+#endif
+
         return true;
     }
 }
@@ -0,0 +1,42 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <etl/PoolRegistry.h>
+
+using ETL_NAMESPACE::PoolRegistry;
+
+
+std::atomic<PoolRegistry::Entry*>& PoolRegistry::head() noexcept {
+
+    static std::atomic<Entry*> h {nullptr};
+    return h;
+}
+
+
+void PoolRegistry::add(Entry& entry) noexcept {
+
+    Entry* old = head().load(std::memory_order_relaxed);
+    do {
+        entry.next = old;
+    } while (!head().compare_exchange_weak(
+        old, &entry, std::memory_order_release, std::memory_order_relaxed));
+}
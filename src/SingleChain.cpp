@@ -48,6 +48,40 @@ SingleChain::Node* SingleChain::removeAfter(Node* pos) noexcept {
 }
 
 
+void SingleChain::spliceAfter(Node* pos, Node* before, Node* back) noexcept {
+
+    ETL_ASSERT(pos != nullptr);
+    ETL_ASSERT(before != nullptr);
+    ETL_ASSERT(back != nullptr);
+
+    if ((pos == before) || (pos == back)) {
+        return;
+    }
+
+    Node* first = before->next;
+    ETL_ASSERT(first != nullptr);
+
+    linkNodes(before, back->next);
+    linkNodes(back, pos->next);
+    linkNodes(pos, first);
+}
+
+
+void SingleChain::reverse() noexcept {
+
+    Node* prev = nullptr;
+    Node* node = frontNode.next;
+    while (node != nullptr) {
+        Node* next = node->next;
+        node->next = prev;
+        prev = node;
+        node = next;
+    }
+
+    frontNode.next = prev;
+}
+
+
 void SingleChain::takeListOf(SingleChain& other) noexcept {
 
     if (&other != this) {
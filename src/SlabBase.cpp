@@ -0,0 +1,319 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <etl/base/SlabBase.h>
+
+#include <cstdint>
+
+using ETL_NAMESPACE::Detail::SlabBase;
+
+
+constexpr std::size_t SlabBase::MIN_BLOCK;
+constexpr std::size_t SlabBase::MAX_CLASSES;
+constexpr std::size_t SlabBase::MAX_ALIGN;
+constexpr std::size_t SlabBase::PAGE_INFO_SIZE;
+constexpr uint8_t SlabBase::PAGE_FREE;
+constexpr uint8_t SlabBase::PAGE_RUN;
+constexpr uint8_t SlabBase::PAGE_CLASS;
+constexpr uint32_t SlabBase::NO_PAGE;
+
+
+SlabBase::SlabBase(void* region, std::size_t size, std::size_t ps) noexcept :
+    SlabBase(region, size, ps, nullptr, 0U) {}
+
+
+SlabBase::SlabBase(void* region,
+                   std::size_t size,
+                   std::size_t ps,
+                   const std::size_t* sizes,
+                   std::size_t num) noexcept :
+    pageInfo {static_cast<PageInfo*>(region)},
+    pages {nullptr},
+    pageSize {ps},
+    pageCnt {0U},
+    classCnt {0U},
+    classSizes {},
+    partialPages {},
+    freeBlocks {},
+    freePages {0U},
+    usedBytes {0U} {
+
+    ETL_ASSERT(region != nullptr);
+    ETL_ASSERT((reinterpret_cast<std::uintptr_t>(region) % MAX_ALIGN) == 0U);
+    ETL_ASSERT((pageSize >= (2U * MIN_BLOCK)) && ((pageSize & (pageSize - 1U)) == 0U));
+    ETL_ASSERT(num <= MAX_CLASSES);
+
+    if (num > 0U) {
+        ETL_ASSERT(sizes != nullptr);
+        for (std::size_t cl = 0U; cl < num; ++cl) {
+            ETL_ASSERT((sizes[cl] >= MIN_BLOCK) && ((sizes[cl] % MIN_BLOCK) == 0U));
+            ETL_ASSERT((cl == 0U) || (sizes[cl] > sizes[cl - 1U]));
+            ETL_ASSERT((2U * sizes[cl]) <= pageSize);
+            classSizes[cl] = sizes[cl];
+        }
+        classCnt = num;
+    } else {
+        while ((classCnt < MAX_CLASSES) && ((2U * (MIN_BLOCK << classCnt)) <= pageSize)) {
+            classSizes[classCnt] = MIN_BLOCK << classCnt;
+            ++classCnt;
+        }
+    }
+
+    for (std::size_t cl = 0U; cl < MAX_CLASSES; ++cl) {
+        partialPages[cl] = NO_PAGE;
+    }
+
+    // Layout: page info for each page, then the pages aligned to MAX_ALIGN.
+    pageCnt = size / (pageSize + sizeof(PageInfo));
+    auto pagesOffset = [](std::size_t cnt) {
+        return ((cnt * sizeof(PageInfo)) + MAX_ALIGN - 1U) & ~(MAX_ALIGN - 1U);
+    };
+    while ((pageCnt > 0U) && ((pagesOffset(pageCnt) + (pageCnt * pageSize)) > size)) {
+        --pageCnt;
+    }
+
+    ETL_ASSERT(pageCnt < NO_PAGE);
+
+    pages = static_cast<uint8_t*>(region) + pagesOffset(pageCnt);
+    freePages = pageCnt;
+    for (std::size_t i = 0U; i < pageCnt; ++i) {
+        pageInfo[i] = PageInfo {nullptr, 0U, NO_PAGE, NO_PAGE, PAGE_FREE};
+    }
+}
+
+
+std::size_t SlabBase::classOf(std::size_t size) const noexcept {
+
+    std::size_t cl = 0U;
+    while ((cl < classCnt) && (blockSize(cl) < size)) {
+        ++cl;
+    }
+
+    return cl;
+}
+
+
+uint8_t* SlabBase::takePages(std::size_t n, uint8_t tag) noexcept {
+
+    if ((n == 0U) || (n > freePages)) {
+        return nullptr;
+    }
+
+    // First fit search for a run of free pages.
+    std::size_t runStart = 0U;
+    std::size_t runLen = 0U;
+    for (std::size_t i = 0U; (i < pageCnt) && (runLen < n); ++i) {
+        if (pageInfo[i].tag == PAGE_FREE) {
+            if (runLen == 0U) {
+                runStart = i;
+            }
+            ++runLen;
+        } else {
+            runLen = 0U;
+        }
+    }
+
+    if (runLen < n) {
+        return nullptr;
+    }
+
+    for (std::size_t i = runStart; i < (runStart + n); ++i) {
+        pageInfo[i].tag = tag;
+    }
+
+    freePages -= n;
+    return pageAt(runStart);
+}
+
+
+void SlabBase::linkPartial(std::size_t cl, uint32_t page) noexcept {
+
+    PageInfo& info = pageInfo[page];
+    info.prev = NO_PAGE;
+    info.next = partialPages[cl];
+    if (info.next != NO_PAGE) {
+        pageInfo[info.next].prev = page;
+    }
+
+    partialPages[cl] = page;
+}
+
+
+void SlabBase::unlinkPartial(std::size_t cl, uint32_t page) noexcept {
+
+    PageInfo& info = pageInfo[page];
+    if (info.prev != NO_PAGE) {
+        pageInfo[info.prev].next = info.next;
+    } else {
+        partialPages[cl] = info.next;
+    }
+
+    if (info.next != NO_PAGE) {
+        pageInfo[info.next].prev = info.prev;
+    }
+
+    info.prev = NO_PAGE;
+    info.next = NO_PAGE;
+}
+
+
+bool SlabBase::refill(std::size_t cl) noexcept {
+
+    uint8_t* page = takePages(1U, static_cast<uint8_t>(PAGE_CLASS + cl));
+    if (page == nullptr) {
+        return false;
+    }
+
+    const auto ix = static_cast<uint32_t>((page - pages) / pageSize);
+    PageInfo& info = pageInfo[ix];
+    info.freeList = nullptr;
+    info.live = 0U;
+
+    const std::size_t bs = blockSize(cl);
+    const std::size_t cnt = blocksPerPage(cl);
+    for (std::size_t i = cnt; i > 0U; --i) {
+        FreeItem* item = reinterpret_cast<FreeItem*>(page + ((i - 1U) * bs));
+        item->next = info.freeList;
+        info.freeList = item;
+    }
+
+    freeBlocks[cl] += cnt;
+    linkPartial(cl, ix);
+    return true;
+}
+
+
+void SlabBase::releaseClassPage(std::size_t cl, uint32_t page) noexcept {
+
+    unlinkPartial(cl, page);
+    pageInfo[page].freeList = nullptr;
+    pageInfo[page].tag = PAGE_FREE;
+    freeBlocks[cl] -= blocksPerPage(cl);
+    ++freePages;
+}
+
+
+void* SlabBase::allocate(std::size_t size, std::size_t align) noexcept {
+
+    if ((size == 0U) || (align > MAX_ALIGN)) {
+        return nullptr;
+    }
+
+    const std::size_t cl = classOf(size);
+
+    if (cl < classCnt) {
+
+        if ((partialPages[cl] == NO_PAGE) && !refill(cl)) {
+            return nullptr;
+        }
+
+        const uint32_t page = partialPages[cl];
+        PageInfo& info = pageInfo[page];
+        FreeItem* item = info.freeList;
+        info.freeList = item->next;
+        ++info.live;
+        if (info.freeList == nullptr) {
+            unlinkPartial(cl, page);
+        }
+
+        --freeBlocks[cl];
+        usedBytes += blockSize(cl);
+        return item;
+
+    } else {
+
+        const std::size_t n = pagesFor(size);
+        void* run = takePages(n, PAGE_RUN);
+        if (run != nullptr) {
+            usedBytes += n * pageSize;
+        }
+
+        return run;
+    }
+}
+
+
+void SlabBase::deallocate(void* ptr, std::size_t size) noexcept {
+
+    if (ptr == nullptr) {
+        return;
+    }
+
+    uint8_t* const p = static_cast<uint8_t*>(ptr);
+    ETL_ASSERT((p >= pages) && (p < (pages + capacity())));
+
+    const auto page = static_cast<uint32_t>(static_cast<std::size_t>(p - pages) / pageSize);
+    const std::size_t cl = classOf(size);
+
+    if (cl < classCnt) {
+
+        PageInfo& info = pageInfo[page];
+        ETL_ASSERT(info.tag == (PAGE_CLASS + cl));
+        ETL_ASSERT(info.live > 0U);
+
+        if (info.freeList == nullptr) {
+            linkPartial(cl, page);
+        }
+
+        FreeItem* item = static_cast<FreeItem*>(ptr);
+        item->next = info.freeList;
+        info.freeList = item;
+        --info.live;
+        ++freeBlocks[cl];
+        usedBytes -= blockSize(cl);
+
+        // An empty page is kept only when it is the last one with free blocks.
+        const bool lastPartial = (info.prev == NO_PAGE) && (info.next == NO_PAGE);
+        if ((info.live == 0U) && !lastPartial) {
+            releaseClassPage(cl, page);
+        }
+
+    } else {
+
+        const std::size_t n = pagesFor(size);
+        ETL_ASSERT((page + n) <= pageCnt);
+
+        for (std::size_t i = page; i < (page + n); ++i) {
+            ETL_ASSERT(pageInfo[i].tag == PAGE_RUN);
+            pageInfo[i].tag = PAGE_FREE;
+        }
+
+        freePages += n;
+        usedBytes -= n * pageSize;
+    }
+}
+
+
+std::size_t SlabBase::available(std::size_t size) const noexcept {
+
+    if (size == 0U) {
+        return 0U;
+    }
+
+    const std::size_t cl = classOf(size);
+
+    if (cl < classCnt) {
+        return freeBlocks[cl] + (freePages * blocksPerPage(cl));
+    } else {
+        return freePages / pagesFor(size);
+    }
+}
@@ -23,6 +23,7 @@ limitations under the License.
 #include <catch2/catch.hpp>
 
 #include <etl/BufStr.h>
+#include <etl/List.h>
 #include <etl/Map.h>
 #include <etl/Span.h>
 #include <etl/UnorderedMap.h>
@@ -30,6 +31,8 @@ limitations under the License.
 
 #include <cstdlib>
 #include <ctime>
+#include <deque>
+#include <forward_list>
 #include <iostream>
 #include <list>
 #include <map>
@@ -410,13 +413,14 @@ void testVectorInsert(const SRC& src) {
     using T = typename SRC::value_type;
 
     static constexpr size_t INIT_ELEMENTS = 300U;
+    const auto srcSize = static_cast<size_t>(std::distance(src.begin(), src.end()));
 
     BENCHMARK_ADVANCED("Static::Vector<T>")(Catch::Benchmark::Chronometer meter) {
         static constexpr size_t N = 11000UL;
         Etl::Static::Vector<T, N> vec;
-        REQUIRE((src.size() + INIT_ELEMENTS) < vec.capacity());
+        REQUIRE((srcSize + INIT_ELEMENTS) < vec.capacity());
 
-        vec.reserve(src.size() + INIT_ELEMENTS);
+        vec.reserve(srcSize + INIT_ELEMENTS);
         meter.measure([&vec, &src] {
             vec.insert(vec.begin(), INIT_ELEMENTS, T {78});
             auto it = vec.begin() + 5;
@@ -428,7 +432,7 @@ void testVectorInsert(const SRC& src) {
 
     BENCHMARK_ADVANCED("Dynamic::Vector<T>")(Catch::Benchmark::Chronometer meter) {
         Etl::Dynamic::Vector<T> vec;
-        vec.reserve(src.size() + INIT_ELEMENTS);
+        vec.reserve(srcSize + INIT_ELEMENTS);
         meter.measure([&vec, &src] {
             vec.insert(vec.begin(), INIT_ELEMENTS, T {78});
             auto it = vec.begin() + 5;
@@ -440,7 +444,7 @@ void testVectorInsert(const SRC& src) {
 
     BENCHMARK_ADVANCED("std::vector<T>")(Catch::Benchmark::Chronometer meter) {
         std::vector<T> vec;
-        vec.reserve(src.size() + INIT_ELEMENTS);
+        vec.reserve(srcSize + INIT_ELEMENTS);
         meter.measure([&vec, &src] {
             vec.insert(vec.begin(), INIT_ELEMENTS, T {78});
             auto it = vec.begin() + 5;
@@ -498,6 +502,72 @@ TEST_CASE("Etl::Vector<T> insert from...", "[vec][insert][foreign][etl]") {
             testVectorInsert(src);
         }
     }
+
+    SECTION("...std::forward_list<T>") {
+        SECTION("T = int") {
+            using SRC = std::forward_list<int>;
+            SRC src;
+            for (size_t i = 0; i < N; ++i) {
+                src.push_front(static_cast<int>(i));
+            }
+
+            testVectorInsert(src);
+        }
+
+        SECTION("T = ContainerTester") {
+            using SRC = std::forward_list<ContainerTester>;
+            SRC src;
+            for (size_t i = 0; i < N; ++i) {
+                src.push_front(ContainerTester(i));
+            }
+
+            testVectorInsert(src);
+        }
+    }
+
+    SECTION("...std::deque<T>") {
+        SECTION("T = int") {
+            using SRC = std::deque<int>;
+            SRC src;
+            for (size_t i = 0; i < N; ++i) {
+                src.push_back(static_cast<int>(i));
+            }
+
+            testVectorInsert(src);
+        }
+
+        SECTION("T = ContainerTester") {
+            using SRC = std::deque<ContainerTester>;
+            SRC src;
+            for (size_t i = 0; i < N; ++i) {
+                src.push_back(ContainerTester(i));
+            }
+
+            testVectorInsert(src);
+        }
+    }
+
+    SECTION("...Etl::List<T>") {
+        SECTION("T = int") {
+            using SRC = Etl::Dynamic::List<int>;
+            SRC src;
+            for (size_t i = 0; i < N; ++i) {
+                src.push_back(static_cast<int>(i));
+            }
+
+            testVectorInsert(src);
+        }
+
+        SECTION("T = ContainerTester") {
+            using SRC = Etl::Dynamic::List<ContainerTester>;
+            SRC src;
+            for (size_t i = 0; i < N; ++i) {
+                src.push_back(ContainerTester(i));
+            }
+
+            testVectorInsert(src);
+        }
+    }
 }
 
 
@@ -0,0 +1,210 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include <etl/Algorithms.h>
+#include <etl/Array.h>
+#include <etl/Span.h>
+#include <etl/Vector.h>
+
+#include "ContainerTester.h"
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+static_assert(Etl::Detail::IsContiguous<Etl::Dynamic::Vector<int>>::value,
+              "Vector<> should be contiguous");
+static_assert(Etl::Detail::IsContiguous<Etl::Static::Vector<int, 4U>>::value,
+              "Static::Vector<> should be contiguous");
+static_assert(Etl::Detail::IsContiguous<Etl::Span<int>>::value, "Span<> should be contiguous");
+static_assert(Etl::Detail::IsContiguous<Etl::Span<const int>>::value,
+              "Span<const> should be contiguous");
+static_assert(Etl::Detail::IsContiguous<Etl::Array<int, 4U>>::value,
+              "Array<> should be contiguous");
+static_assert(Etl::Detail::IsContiguous<std::vector<int>>::value,
+              "std::vector<> should be contiguous");
+static_assert(Etl::Detail::IsContiguous<std::array<int, 4U>>::value,
+              "std::array<> should be contiguous");
+static_assert(!Etl::Detail::IsContiguous<std::list<int>>::value,
+              "std::list<> should not be contiguous");
+
+// Sizes around the kernel block size to cover both the block and the tail loops.
+const std::size_t SIZES[] = {0U, 1U, 7U, 31U, 32U, 33U, 64U, 100U};
+
+
+template<class T>
+T valueOf(std::size_t i) {
+    return static_cast<T>(i % 50U);
+}
+
+template<>
+ContainerTester valueOf<ContainerTester>(std::size_t i) {
+    return ContainerTester(static_cast<int>(i % 50U));
+}
+
+
+template<class T>
+void testFindAndCount() {
+
+    for (auto size : SIZES) {
+
+        Etl::Dynamic::Vector<T> vec;
+        for (std::size_t i = 0U; i < size; ++i) {
+            vec.push_back(valueOf<T>(i));
+        }
+
+        const auto& cVec = vec;
+        Etl::Span<T> span(vec);
+
+        for (std::size_t i = 0U; i < 55U; ++i) {
+
+            const T value = valueOf<T>(i);
+
+            CAPTURE(size);
+            CAPTURE(i);
+            REQUIRE(Etl::find(vec, value) == std::find(vec.begin(), vec.end(), value));
+            REQUIRE(Etl::find(cVec, value) == std::find(cVec.begin(), cVec.end(), value));
+            REQUIRE(Etl::find(span, value) == std::find(span.begin(), span.end(), value));
+
+            REQUIRE(Etl::count(vec, value)
+                    == static_cast<std::size_t>(std::count(vec.begin(), vec.end(), value)));
+            REQUIRE(Etl::count(span, value)
+                    == static_cast<std::size_t>(std::count(span.begin(), span.end(), value)));
+        }
+    }
+}
+
+
+template<class T>
+void testMinMax() {
+
+    for (auto size : SIZES) {
+
+        Etl::Dynamic::Vector<T> vec;
+        for (std::size_t i = 0U; i < size; ++i) {
+            vec.push_back(valueOf<T>((i * 7U) + 3U));
+        }
+
+        CAPTURE(size);
+        REQUIRE(Etl::min_element(vec) == std::min_element(vec.begin(), vec.end()));
+        REQUIRE(Etl::max_element(vec) == std::max_element(vec.begin(), vec.end()));
+
+        const Etl::Span<const T> span(vec);
+        REQUIRE(Etl::min_element(span) == std::min_element(span.begin(), span.end()));
+        REQUIRE(Etl::max_element(span) == std::max_element(span.begin(), span.end()));
+    }
+}
+
+
+template<class T>
+void testCompare() {
+
+    for (auto size : SIZES) {
+
+        Etl::Dynamic::Vector<T> lhs;
+        for (std::size_t i = 0U; i < size; ++i) {
+            lhs.push_back(valueOf<T>(i));
+        }
+
+        Etl::Static::Vector<T, 128U> rhs(lhs);
+
+        CAPTURE(size);
+        REQUIRE(lhs == rhs);
+        REQUIRE_FALSE(lhs < rhs);
+        REQUIRE_FALSE(rhs < lhs);
+
+        if (size > 0U) {
+
+            for (std::size_t i : {std::size_t(0U), size / 2U, size - 1U}) {
+
+                CAPTURE(i);
+                rhs[i] = static_cast<T>(60);
+                REQUIRE(lhs != rhs);
+                REQUIRE(lhs < rhs);
+                REQUIRE_FALSE(rhs < lhs);
+
+                rhs[i] = lhs[i];
+                REQUIRE(lhs == rhs);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+
+TEMPLATE_TEST_CASE("Etl::find(), Etl::count()",
+                   "[algorithms][etl]",
+                   int,
+                   std::uint8_t,
+                   std::int16_t,
+                   std::uint64_t,
+                   double,
+                   ContainerTester) {
+
+    testFindAndCount<TestType>();
+}
+
+
+TEMPLATE_TEST_CASE("Etl::min_element(), Etl::max_element()",
+                   "[algorithms][etl]",
+                   int,
+                   std::uint8_t,
+                   std::int16_t,
+                   std::uint64_t,
+                   double,
+                   ContainerTester) {
+
+    testMinMax<TestType>();
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Vector<> element comparison",
+                   "[algorithms][vec][etl]",
+                   int,
+                   std::uint8_t,
+                   std::int16_t,
+                   std::uint64_t,
+                   double) {
+
+    testCompare<TestType>();
+}
+
+
+TEST_CASE("Etl::find() on Array<>", "[algorithms][etl]") {
+
+    Etl::Array<std::uint16_t, 40U> arr {};
+    arr[35] = 7U;
+
+    REQUIRE(Etl::find(arr, 7U) == arr.begin() + 35);
+    REQUIRE(Etl::find(arr, 8U) == arr.end());
+    REQUIRE(Etl::count(arr, 0U) == 39U);
+    REQUIRE(Etl::max_element(arr) == arr.begin() + 35);
+    REQUIRE(Etl::min_element(arr) == arr.begin());
+}
@@ -0,0 +1,190 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include <etl/List.h>
+#include <etl/Map.h>
+#include <etl/MonotonicArena.h>
+#include <etl/Vector.h>
+
+#include "ContainerTester.h"
+
+#include <cstdint>
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+TEST_CASE("Etl::MonotonicArena basic test", "[arena][etl]") {
+
+    alignas(std::max_align_t) uint8_t buffer[256];
+    Etl::MonotonicArena arena {buffer, sizeof(buffer)};
+
+    const auto cap = arena.capacity();
+    REQUIRE(cap > 0U);
+    REQUIRE(cap < sizeof(buffer));
+    REQUIRE(arena.available() == cap);
+
+    void* a = arena.allocate(3U, 1U);
+    void* b = arena.allocate(8U, 8U);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE((reinterpret_cast<std::uintptr_t>(b) % 8U) == 0U);
+    REQUIRE(static_cast<uint8_t*>(b) > static_cast<uint8_t*>(a));
+    REQUIRE(arena.getUsed() >= 11U);
+
+    REQUIRE(arena.allocate(cap, 1U) == nullptr);
+
+    arena.reset();
+    REQUIRE(arena.getUsed() == 0U);
+    REQUIRE(arena.available() == cap);
+    REQUIRE(arena.allocate(3U, 1U) == a);
+}
+
+
+TEST_CASE("Etl::MonotonicArena with multiple buffers", "[arena][etl]") {
+
+    alignas(std::max_align_t) uint8_t buffer1[64];
+    alignas(std::max_align_t) uint8_t buffer2[128];
+
+    Etl::MonotonicArena arena;
+    REQUIRE(arena.allocate(1U, 1U) == nullptr);
+
+    REQUIRE(arena.addBuffer(buffer1, sizeof(buffer1)));
+    REQUIRE(arena.addBuffer(buffer2, sizeof(buffer2)));
+    REQUIRE_FALSE(arena.addBuffer(buffer2, 4U));
+
+    auto* a = static_cast<uint8_t*>(arena.allocate(40U, 8U));
+    auto* b = static_cast<uint8_t*>(arena.allocate(40U, 8U));
+
+    REQUIRE(a >= buffer1);
+    REQUIRE(a < (buffer1 + sizeof(buffer1)));
+    REQUIRE(b >= buffer2);
+    REQUIRE(b < (buffer2 + sizeof(buffer2)));
+
+    arena.reset();
+    REQUIRE(arena.allocate(40U, 8U) == a);
+}
+
+
+TEST_CASE("Etl::Arena containers", "[arena][etl]") {
+
+    Etl::StaticArena<4096U> arena;
+
+    {
+        Etl::Arena::Vector<int> vec {arena, {1, 2, 3}};
+        Etl::Arena::List<ContainerTester> list {arena};
+        Etl::Arena::Map<int, ContainerTester> map {arena};
+
+        for (int i = 0; i < 20; ++i) {
+            vec.push_back(i);
+            list.emplace_back(i);
+            map.emplace(i, i);
+        }
+
+        REQUIRE(vec.size() == 23U);
+        REQUIRE(vec[3] == 0);
+        REQUIRE(list.size() == 20U);
+        REQUIRE(list.back() == ContainerTester(19));
+        REQUIRE(map.size() == 20U);
+        REQUIRE(map.find(7)->second == ContainerTester(7));
+        REQUIRE(arena.getUsed() > 0U);
+
+        SECTION("deallocation is a no-op") {
+            const auto used = arena.getUsed();
+            list.clear();
+            map.erase(3);
+            REQUIRE(arena.getUsed() == used);
+        }
+
+        SECTION("swap within the same arena") {
+            Etl::Arena::List<ContainerTester> other {arena, {ContainerTester(-1)}};
+            const auto* addr = &list.front();
+
+            list.swap(other);
+            REQUIRE(list.size() == 1U);
+            REQUIRE(&other.front() == addr);
+
+            Etl::Arena::Vector<int> otherVec {arena};
+            const auto* data = vec.data();
+            swap(vec, otherVec);
+            REQUIRE(vec.empty());
+            REQUIRE(otherVec.data() == data);
+
+            Etl::Vector<int>& base = otherVec;
+            base.swap(vec);
+            REQUIRE(otherVec.empty());
+            REQUIRE(vec.data() == data);
+        }
+
+        SECTION("move binds to the same arena") {
+            const auto* addr = &list.front();
+            Etl::Arena::List<ContainerTester> moved {std::move(list)};
+
+            REQUIRE(&moved.getArena() == &arena);
+            REQUIRE(&moved.front() == addr);
+            REQUIRE(list.empty());
+        }
+
+        SECTION("swap with different arena") {
+            Etl::StaticArena<1024U> otherArena;
+            Etl::Arena::List<ContainerTester> other {otherArena, {ContainerTester(-1)}};
+
+            list.swap(other);
+            REQUIRE(list.size() == 1U);
+            REQUIRE(other.size() == 20U);
+            REQUIRE(&other.getArena() == &otherArena);
+            REQUIRE(list.front() == ContainerTester(-1));
+        }
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+
+    arena.reset();
+    REQUIRE(arena.getUsed() == 0U);
+}
+
+
+TEST_CASE("Etl::ArenaAllocator size()", "[arena][etl]") {
+
+    Etl::StaticArena<512U> arena;
+    Etl::ArenaAllocator<int> alloc {arena};
+
+    REQUIRE(alloc.size() == 0U);
+
+    int* items = alloc.allocate(4U);
+    REQUIRE(items != nullptr);
+    REQUIRE(alloc.allocate(2U) != nullptr);
+    REQUIRE(alloc.size() == 6U);
+
+    alloc.deallocate(items, 4U);
+    REQUIRE(alloc.size() == 6U);
+
+    arena.reset();
+    REQUIRE(alloc.size() == 0U);
+
+    REQUIRE(alloc.allocate(1U) != nullptr);
+    REQUIRE(alloc.size() == 1U);
+}
+
+}  // namespace
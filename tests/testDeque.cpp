@@ -0,0 +1,387 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#include <catch2/catch.hpp>
+
+#include <etl/Deque.h>
+
+#include "ContainerTester.h"
+#include "comparisionTests.h"
+#include "constructorTests.h"
+#include "sequenceTests.h"
+
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+static constexpr std::size_t BLOCK {4U};
+
+
+TEMPLATE_TEST_CASE("Etl::Deque<> constructor test",
+                   "[deque][etl]",
+                   (Etl::Dynamic::Deque<ContainerTester, BLOCK>),
+                   (Etl::Static::Deque<ContainerTester, 16U, BLOCK>),
+                   (Etl::Pooled::Deque<ContainerTester, 16U, BLOCK>)) {
+
+    SECTION("D(size_t)") {
+        Etl::Test::constructForSize<TestType>();
+    }
+
+    SECTION("D(size_t, const value_type&)") {
+        Etl::Test::constructForSizeAndValue<TestType>(ContainerTester {17});
+    }
+
+    SECTION("D(InputIt, IntputIt)") {
+        Etl::Test::constructWithIterators<TestType>();
+    }
+
+    SECTION("D(std::initializer_list)") {
+        Etl::Test::constructWithInitList<TestType>();
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Deque<> push/pop test",
+                   "[deque][etl]",
+                   (Etl::Dynamic::Deque<int, BLOCK>),
+                   (Etl::Static::Deque<int, 16U, BLOCK>),
+                   (Etl::Pooled::Deque<int, 16U, BLOCK>)) {
+
+    Etl::Test::testBackAccess<TestType>();
+    Etl::Test::testFrontAccess<TestType>();
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Deque<> iteration test",
+                   "[deque][etl]",
+                   (Etl::Dynamic::Deque<int, BLOCK>),
+                   (Etl::Static::Deque<int, 16U, BLOCK>),
+                   (Etl::Pooled::Deque<int, 16U, BLOCK>)) {
+
+    Etl::Test::testIterationForward<TestType>();
+    Etl::Test::testIterationBackward<TestType>();
+    Etl::Test::testReverseIterationForward<TestType>();
+    Etl::Test::testReverseIterationBackward<TestType>();
+
+    TestType c {5, 3, 9};
+    c.push_front(1);
+    c.push_front(7);
+    c.push_front(2);
+
+    std::sort(c.begin(), c.end());
+    REQUIRE(std::is_sorted(c.cbegin(), c.cend()));
+    REQUIRE((c.end() - c.begin()) == 6);
+    REQUIRE(c.begin()[4] == 7);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Deque<> mixed operations",
+                   "[deque][etl]",
+                   (Etl::Dynamic::Deque<int, BLOCK>),
+                   (Etl::Static::Deque<int, 32U, BLOCK>),
+                   (Etl::Pooled::Deque<int, 32U, BLOCK>)) {
+
+    TestType c;
+    std::deque<int> ref;
+
+    // Deterministic mix of operations on both ends, keeping at most 30 items.
+    unsigned seed = 12345U;
+    for (int i = 0; i < 2000; ++i) {
+
+        seed = (seed * 1103515245U) + 12345U;
+        const unsigned op = (seed >> 16U) % 4U;
+
+        if ((op == 0U) && (ref.size() < 30U)) {
+            c.push_back(i);
+            ref.push_back(i);
+        } else if ((op == 1U) && (ref.size() < 30U)) {
+            c.push_front(i);
+            ref.push_front(i);
+        } else if ((op == 2U) && !ref.empty()) {
+            c.pop_back();
+            ref.pop_back();
+        } else if (!ref.empty()) {
+            c.pop_front();
+            ref.pop_front();
+        }
+
+        REQUIRE(c.size() == ref.size());
+        REQUIRE(std::equal(c.begin(), c.end(), ref.begin()));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Deque<> element stability",
+                   "[deque][etl]",
+                   (Etl::Dynamic::Deque<ContainerTester, BLOCK>),
+                   (Etl::Static::Deque<ContainerTester, 16U, BLOCK>),
+                   (Etl::Pooled::Deque<ContainerTester, 16U, BLOCK>)) {
+
+    TestType c;
+    std::vector<const ContainerTester*> addresses;
+
+    const auto moveCnt = ContainerTester::getMoveCount();
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    for (int i = 0; i < 8; ++i) {
+        c.emplace_back(i);
+        addresses.push_back(&c.back());
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        c.emplace_front(-i - 1);
+        addresses.insert(addresses.begin(), &c.front());
+    }
+
+    REQUIRE(c.size() == 16U);
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(&c[i] == addresses[i]);
+        REQUIRE(c[i] == ContainerTester(i - 8));
+    }
+
+    SECTION("pop at both ends") {
+
+        c.pop_front();
+        c.pop_front();
+        c.pop_back();
+
+        REQUIRE(c.size() == 13U);
+        REQUIRE(&c.front() == addresses[2]);
+        REQUIRE(&c.back() == addresses[14]);
+
+        c.shrink_to_fit();
+        REQUIRE(&c.front() == addresses[2]);
+        REQUIRE(&c.back() == addresses[14]);
+    }
+
+    SECTION("clear()") {
+
+        c.clear();
+
+        REQUIRE(c.empty());
+        REQUIRE(ContainerTester::getObjectCount() == 0U);
+    }
+}
+
+
+TEST_CASE("Etl::Static::Deque<> capacity test", "[deque][static][etl]") {
+
+    Etl::Static::Deque<int, 10U, BLOCK> c;
+
+    REQUIRE(c.max_size() == 12U);
+
+    for (int i = 0; i < 10; ++i) {
+        c.push_front(i);
+    }
+
+    for (int i = 0; i < 30; ++i) {
+        c.push_back(i);
+    }
+
+    REQUIRE(c.size() == 12U);
+    REQUIRE(c.front() == 9);
+    REQUIRE(c.back() == 1);
+
+    const auto size = c.size();
+    for (int i = 0; i < 1000; ++i) {
+        c.pop_front();
+        c.push_back(i);
+    }
+
+    REQUIRE(c.size() == size);
+    REQUIRE(c.back() == 999);
+}
+
+
+TEST_CASE("Etl::Deque<> block reuse around the ring", "[deque][etl]") {
+
+    Etl::Static::Deque<int, 10U, BLOCK> c;
+    std::deque<int> ref;
+
+    for (int i = 0; i < 6; ++i) {
+        c.push_back(i);
+        ref.push_back(i);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        c.push_front(100 + i);
+        ref.push_front(100 + i);
+        c.pop_back();
+        ref.pop_back();
+    }
+
+    REQUIRE(c.size() == ref.size());
+    REQUIRE(std::equal(c.begin(), c.end(), ref.begin()));
+
+    for (int i = 0; i < 100; ++i) {
+        c.push_back(200 + i);
+        ref.push_back(200 + i);
+        c.pop_front();
+        ref.pop_front();
+    }
+
+    REQUIRE(c.size() == ref.size());
+    REQUIRE(std::equal(c.begin(), c.end(), ref.begin()));
+
+    c.shrink_to_fit();
+    while (c.size() < c.max_size()) {
+        c.push_front(-1);
+        ref.push_front(-1);
+    }
+
+    REQUIRE(c.size() == ref.size());
+    REQUIRE(std::equal(c.begin(), c.end(), ref.begin()));
+}
+
+
+TEST_CASE("Etl::Deque<> swap without room keeps both sides", "[deque][etl]") {
+
+    Etl::Static::Deque<int, 4U, BLOCK> small {1, 2};
+    Etl::Dynamic::Deque<int, BLOCK> big {3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    swap(static_cast<Etl::Deque<int, BLOCK>&>(small), static_cast<Etl::Deque<int, BLOCK>&>(big));
+
+    REQUIRE(small.size() == 2U);
+    REQUIRE(small.back() == 2);
+    REQUIRE(big.size() == 9U);
+    REQUIRE(big.back() == 11);
+}
+
+
+struct ThrowOnNegative {
+
+    int value;
+
+    explicit ThrowOnNegative(int v) :
+        value(v) {
+        if (v < 0) {
+            throw std::runtime_error("negative");
+        }
+    }
+};
+
+
+TEST_CASE("Etl::Deque<> emplace_front() keeps the deque on throw", "[deque][etl]") {
+
+    Etl::Dynamic::Deque<ThrowOnNegative, BLOCK> c;
+
+    for (int i = 1; i <= 4; ++i) {
+        c.emplace_front(i);
+    }
+
+    // Once needing a new front block, once with a free slot in it
+    for (int round = 0; round < 2; ++round) {
+
+        REQUIRE_THROWS(c.emplace_front(-1));
+        REQUIRE(c.size() == static_cast<std::size_t>(4 + round));
+        REQUIRE(c.front().value == 4 + round);
+        REQUIRE(c.back().value == 1);
+
+        c.emplace_front(5 + round);
+    }
+
+    REQUIRE(c.size() == 6U);
+    REQUIRE(c.front().value == 6);
+    REQUIRE(c.back().value == 1);
+}
+
+
+TEST_CASE("Etl::Deque<> assignment and swap", "[deque][etl]") {
+
+    using DynType = Etl::Dynamic::Deque<ContainerTester, BLOCK>;
+    using StaticType = Etl::Static::Deque<ContainerTester, 16U, BLOCK>;
+
+    DynType dyn {ContainerTester(1), ContainerTester(2), ContainerTester(3)};
+    StaticType stat {ContainerTester(4), ContainerTester(5)};
+
+    SECTION("copy to base") {
+
+        Etl::Deque<ContainerTester, BLOCK>& base = stat;
+        base = dyn;
+
+        REQUIRE(stat == dyn);
+    }
+
+    SECTION("swap with same allocator") {
+
+        DynType other {ContainerTester(7)};
+        other.push_front(ContainerTester(6));
+        const auto* addr = &other.front();
+
+        dyn.swap(other);
+
+        REQUIRE(dyn.size() == 2U);
+        REQUIRE(other.size() == 3U);
+        REQUIRE(&dyn.front() == addr);
+        REQUIRE(dyn.back() == ContainerTester(7));
+    }
+
+    SECTION("swap with different allocator") {
+
+        swap(static_cast<Etl::Deque<ContainerTester, BLOCK>&>(dyn),
+             static_cast<Etl::Deque<ContainerTester, BLOCK>&>(stat));
+
+        REQUIRE(dyn.size() == 2U);
+        REQUIRE(stat.size() == 3U);
+        REQUIRE(dyn.back() == ContainerTester(5));
+        REQUIRE(stat.back() == ContainerTester(3));
+    }
+
+    SECTION("move") {
+
+        StaticType moved(std::move(stat));
+
+        REQUIRE(moved.size() == 2U);
+        REQUIRE(stat.empty());
+    }
+}
+
+
+TEST_CASE("Etl::Deque<> comparision", "[deque][etl]") {
+
+    Etl::Dynamic::Deque<int, BLOCK> lhs {1, 2, 3, 4, 5};
+    Etl::Static::Deque<int, 16U, BLOCK> rhs {2, 3, 4, 6};
+    rhs.push_front(1);
+
+    REQUIRE(lhs != rhs);
+    REQUIRE(lhs < rhs);
+
+    rhs.back() = 5;
+    REQUIRE(lhs == rhs);
+}
+
+
+TEST_CASE("Etl::Deque<> test cleanup", "[deque][etl]") {
+
+    CHECK(ContainerTester::getObjectCount() == 0);
+}
+
+}  // namespace
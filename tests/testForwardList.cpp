@@ -0,0 +1,294 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include <etl/ForwardList.h>
+#include <etl/List.h>
+
+#include <vector>
+
+#include "ContainerTester.h"
+#include "constructorTests.h"
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+static_assert(sizeof(Etl::ForwardList<void*>::Node) == (2U * sizeof(void*)),
+              "ForwardList node shall carry a single link");
+static_assert(sizeof(Etl::ForwardList<void*>::Node) < sizeof(Etl::List<void*>::Node),
+              "ForwardList node shall be smaller than List node");
+
+
+template<class C>
+std::vector<int> valuesOf(const C& cont) {
+    std::vector<int> res;
+    for (const auto& item : cont) {
+        res.push_back(item.getValue());
+    }
+    return res;
+}
+
+
+TEMPLATE_TEST_CASE("Etl::ForwardList<> constructor test",
+                   "[forwardlist][etl]",
+                   (Etl::Dynamic::ForwardList<ContainerTester>),
+                   (Etl::Static::ForwardList<ContainerTester, 16U>),
+                   (Etl::Pooled::ForwardList<ContainerTester, 16U>)) {
+
+    SECTION("FL(size_t)") {
+        Etl::Test::constructForSize<TestType>();
+    }
+
+    SECTION("FL(size_t, const value_type&)") {
+        Etl::Test::constructForSizeAndValue<TestType>(ContainerTester {17});
+    }
+
+    SECTION("FL(InputIt, IntputIt)") {
+        Etl::Test::constructWithIterators<TestType>();
+    }
+
+    SECTION("FL(std::initializer_list)") {
+        Etl::Test::constructWithInitList<TestType>();
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::ForwardList<> modifiers",
+                   "[forwardlist][etl]",
+                   (Etl::Dynamic::ForwardList<ContainerTester>),
+                   (Etl::Static::ForwardList<ContainerTester, 16U>),
+                   (Etl::Pooled::ForwardList<ContainerTester, 16U>)) {
+
+    {
+        TestType list;
+
+        REQUIRE(list.empty());
+
+        list.push_front(ContainerTester(3));
+        list.push_front(ContainerTester(1));
+        list.emplace_front(0);
+
+        REQUIRE(list.size() == 3U);
+        REQUIRE(list.front() == ContainerTester(0));
+        REQUIRE(valuesOf(list) == std::vector<int> {0, 1, 3});
+
+        SECTION("insert_after()") {
+
+            auto it = list.begin();
+            ++it;
+            it = list.insert_after(it, ContainerTester(2));
+            REQUIRE(*it == ContainerTester(2));
+
+            it = list.insert_after(list.before_begin(), 2U, ContainerTester(-1));
+            REQUIRE(*it == ContainerTester(-1));
+
+            const std::vector<ContainerTester> tail {ContainerTester(4), ContainerTester(5)};
+            auto last = list.begin();
+            for (int i = 0; i < 5; ++i) {
+                ++last;
+            }
+            list.insert_after(last, tail.begin(), tail.end());
+
+            REQUIRE(list.size() == 8U);
+            REQUIRE(valuesOf(list) == std::vector<int> {-1, -1, 0, 1, 2, 3, 4, 5});
+        }
+
+        SECTION("erase_after()") {
+
+            auto it = list.erase_after(list.begin());
+            REQUIRE(*it == ContainerTester(3));
+            REQUIRE(valuesOf(list) == std::vector<int> {0, 3});
+
+            list.pop_front();
+            REQUIRE(list.size() == 1U);
+            REQUIRE(list.front() == ContainerTester(3));
+
+            list.assign({ContainerTester(1), ContainerTester(2), ContainerTester(3)});
+            it = list.erase_after(list.before_begin(), list.end());
+            REQUIRE(it == list.end());
+            REQUIRE(list.empty());
+        }
+
+        SECTION("remove_if()") {
+
+            auto cnt = list.remove_if([](const ContainerTester& item) {
+                return (item.getValue() % 2) != 0;
+            });
+
+            REQUIRE(cnt == 2U);
+            REQUIRE(valuesOf(list) == std::vector<int> {0});
+        }
+
+        SECTION("reverse()") {
+
+            list.reverse();
+            REQUIRE(valuesOf(list) == std::vector<int> {3, 1, 0});
+        }
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::ForwardList<>::splice_after() relinks nodes",
+                   "[forwardlist][etl]",
+                   (Etl::Dynamic::ForwardList<ContainerTester>),
+                   (Etl::Pooled::ForwardList<ContainerTester, 16U>)) {
+
+    TestType list {ContainerTester(0), ContainerTester(4)};
+    TestType other {ContainerTester(1), ContainerTester(2), ContainerTester(3)};
+
+    const ContainerTester* addr = &other.front();
+    const auto copyCnt = ContainerTester::getCopyCount();
+    const auto moveCnt = ContainerTester::getMoveCount();
+
+    SECTION("whole list") {
+
+        list.splice_after(list.begin(), other);
+
+        REQUIRE(other.empty());
+        REQUIRE(list.size() == 5U);
+        REQUIRE(valuesOf(list) == std::vector<int> {0, 1, 2, 3, 4});
+
+        auto it = list.begin();
+        ++it;
+        REQUIRE(&*it == addr);
+    }
+
+    SECTION("single element") {
+
+        list.splice_after(list.before_begin(), other, other.begin());
+
+        REQUIRE(other.size() == 2U);
+        REQUIRE(list.size() == 3U);
+        REQUIRE(valuesOf(list) == std::vector<int> {2, 0, 4});
+        REQUIRE(valuesOf(other) == std::vector<int> {1, 3});
+    }
+
+    SECTION("range") {
+
+        list.splice_after(list.begin(), other, other.before_begin(), other.begin());
+        REQUIRE(list.size() == 2U);
+
+        auto last = other.begin();
+        ++last;
+        ++last;
+        list.splice_after(list.begin(), other, other.before_begin(), last);
+
+        REQUIRE(valuesOf(list) == std::vector<int> {0, 1, 2, 4});
+        REQUIRE(valuesOf(other) == std::vector<int> {3});
+    }
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+}
+
+
+TEST_CASE("Etl::ForwardList<> with different allocators", "[forwardlist][etl]") {
+
+    Etl::Dynamic::ForwardList<ContainerTester> dyn {ContainerTester(1),
+                                                    ContainerTester(2),
+                                                    ContainerTester(3)};
+    Etl::Static::ForwardList<ContainerTester, 8U> stat {ContainerTester(7)};
+
+    SECTION("splice_after()") {
+
+        stat.splice_after(stat.begin(), dyn);
+
+        REQUIRE(dyn.empty());
+        REQUIRE(valuesOf(stat) == std::vector<int> {7, 1, 2, 3});
+    }
+
+    SECTION("swap()") {
+
+        swap(static_cast<Etl::ForwardList<ContainerTester>&>(dyn),
+             static_cast<Etl::ForwardList<ContainerTester>&>(stat));
+
+        REQUIRE(valuesOf(dyn) == std::vector<int> {7});
+        REQUIRE(valuesOf(stat) == std::vector<int> {1, 2, 3});
+
+        swap(static_cast<Etl::ForwardList<ContainerTester>&>(dyn),
+             static_cast<Etl::ForwardList<ContainerTester>&>(stat));
+
+        REQUIRE(valuesOf(dyn) == std::vector<int> {1, 2, 3});
+        REQUIRE(valuesOf(stat) == std::vector<int> {7});
+    }
+
+    SECTION("copy and compare") {
+
+        Etl::ForwardList<ContainerTester>& base = stat;
+        base = dyn;
+
+        REQUIRE(stat == dyn);
+
+        stat.front() = ContainerTester(0);
+        REQUIRE(stat != dyn);
+    }
+}
+
+
+TEST_CASE("Etl::Static::ForwardList<> capacity", "[forwardlist][static][etl]") {
+
+    Etl::Static::ForwardList<int, 4U> list;
+
+    REQUIRE(list.max_size() == 4U);
+
+    for (int i = 0; i < 6; ++i) {
+        list.push_front(i);
+    }
+
+    REQUIRE(list.size() == 4U);
+    REQUIRE(list.front() == 3);
+
+    Etl::Static::ForwardList<int, 4U> other {9};
+    other.swap(list);
+
+    REQUIRE(other.size() == 4U);
+    REQUIRE(list.size() == 1U);
+    REQUIRE(list.front() == 9);
+    REQUIRE(list < other);
+}
+
+
+
+TEST_CASE("Etl::Static::ForwardList<> clear() resets the pool", "[forwardlist][static][etl]") {
+
+    Etl::Static::ForwardList<int, 4U> list {1, 2, 3};
+
+    list.clear();
+
+    REQUIRE(list.empty());
+    REQUIRE(list.getAllocator().size() == 0U);
+
+    for (int i = 0; i < 6; ++i) {
+        list.push_front(i);
+    }
+
+    REQUIRE(list.size() == 4U);
+    REQUIRE(list.front() == 3);
+}
+
+}  // namespace
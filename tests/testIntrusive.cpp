@@ -0,0 +1,301 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include <etl/IntrusiveList.h>
+#include <etl/IntrusiveUnorderedSet.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct Item {
+
+    int id;
+    int value;
+    Etl::Intrusive::ListHook byOrder;
+    Etl::Intrusive::ListHook byState;
+    Etl::Intrusive::UnorderedSetHook byId;
+
+    Item(int i, int v) :
+        id(i),
+        value(v) {}
+};
+
+struct IdOf {
+    int operator()(const Item& item) const {
+        return item.id;
+    }
+};
+
+static_assert(std::is_standard_layout<Item>::value, "Item should be standard layout");
+
+struct Tagged {
+    int tag;
+    Etl::Intrusive::ListHook hook;
+};
+
+}  // namespace
+
+
+namespace Etl {
+namespace Intrusive {
+
+template<>
+struct HookOffset<Tagged, ListHook, &Tagged::hook> {
+    static std::size_t value() noexcept {
+        return offsetof(Tagged, hook);
+    }
+};
+
+}  // namespace Intrusive
+}  // namespace Etl
+
+
+namespace {
+
+using OrderList = Etl::Intrusive::List<Item, &Item::byOrder>;
+using StateList = Etl::Intrusive::List<Item, &Item::byState>;
+using IdSet = Etl::Intrusive::UnorderedSet<Item, &Item::byId, IdOf>;
+
+
+std::vector<int> idsOf(const OrderList& list) {
+    std::vector<int> res;
+    for (const auto& item : list) {
+        res.push_back(item.id);
+    }
+    return res;
+}
+
+
+TEST_CASE("Etl::Intrusive::List<> basic operations", "[intrusive][list][etl]") {
+
+    std::vector<Item> items;
+    for (int i = 0; i < 5; ++i) {
+        items.emplace_back(i, i * 10);
+    }
+
+    OrderList list;
+
+    REQUIRE(list.empty());
+
+    list.push_back(items[1]);
+    list.push_back(items[2]);
+    list.push_front(items[0]);
+
+    REQUIRE(list.size() == 3U);
+    REQUIRE(&list.front() == &items[0]);
+    REQUIRE(&list.back() == &items[2]);
+    REQUIRE(idsOf(list) == std::vector<int> {0, 1, 2});
+    REQUIRE(items[1].byOrder.isLinked());
+    REQUIRE_FALSE(items[1].byState.isLinked());
+
+    SECTION("insert() and erase()") {
+
+        auto it = list.insert(OrderList::iterator_to(items[2]), items[4]);
+        REQUIRE(&*it == &items[4]);
+        REQUIRE(idsOf(list) == std::vector<int> {0, 1, 4, 2});
+
+        it = list.erase(OrderList::iterator_to(items[1]));
+        REQUIRE(&*it == &items[4]);
+        REQUIRE_FALSE(items[1].byOrder.isLinked());
+        REQUIRE(idsOf(list) == std::vector<int> {0, 4, 2});
+
+        list.pop_front();
+        list.pop_back();
+        REQUIRE(list.size() == 1U);
+        REQUIRE(&list.front() == &items[4]);
+    }
+
+    SECTION("reverse iteration") {
+
+        std::vector<int> ids;
+        for (auto it = list.rbegin(); it != list.rend(); ++it) {
+            ids.push_back(it->id);
+        }
+
+        REQUIRE(ids == std::vector<int> {2, 1, 0});
+    }
+
+    SECTION("splice()") {
+
+        OrderList other;
+        other.push_back(items[3]);
+        other.push_back(items[4]);
+
+        list.splice(OrderList::iterator_to(items[1]), other);
+
+        REQUIRE(other.empty());
+        REQUIRE(list.size() == 5U);
+        REQUIRE(idsOf(list) == std::vector<int> {0, 3, 4, 1, 2});
+
+        other.splice(other.end(), list, list.begin());
+        REQUIRE(other.size() == 1U);
+        REQUIRE(idsOf(list) == std::vector<int> {3, 4, 1, 2});
+    }
+
+    SECTION("move and swap") {
+
+        OrderList moved(std::move(list));
+        REQUIRE(list.empty());
+        REQUIRE(moved.size() == 3U);
+
+        list.push_back(items[4]);
+        swap(list, moved);
+
+        REQUIRE(list.size() == 3U);
+        REQUIRE(idsOf(moved) == std::vector<int> {4});
+    }
+
+    list.clear();
+
+    REQUIRE(list.empty());
+    for (const auto& item : items) {
+        REQUIRE_FALSE(item.byOrder.isLinked());
+    }
+}
+
+
+TEST_CASE("Etl::Intrusive containers index the same objects", "[intrusive][etl]") {
+
+    std::vector<Item> items;
+    for (int i = 0; i < 20; ++i) {
+        items.emplace_back(i * 7, i);
+    }
+
+    const Item* storage = items.data();
+
+    std::array<IdSet::BucketItem, 8U> buckets;
+    std::array<IdSet::BucketItem, 32U> bigger;
+    IdSet byId {buckets};
+    OrderList order;
+    StateList odd;
+
+    for (auto& item : items) {
+        order.push_back(item);
+        if ((item.value % 2) != 0) {
+            odd.push_back(item);
+        }
+        REQUIRE(byId.insert(item).second);
+    }
+
+    REQUIRE(items.data() == storage);
+    REQUIRE(order.size() == 20U);
+    REQUIRE(odd.size() == 10U);
+    REQUIRE(byId.size() == 20U);
+
+    SECTION("lookup") {
+
+        auto it = byId.find(35);
+        REQUIRE(it != byId.end());
+        REQUIRE(&*it == &items[5]);
+        REQUIRE(byId.count(36) == 0U);
+        REQUIRE(byId.find(36) == byId.end());
+    }
+
+    SECTION("duplicate keys are rejected") {
+
+        Item dup {14, 99};
+        auto res = byId.insert(dup);
+
+        REQUIRE_FALSE(res.second);
+        REQUIRE(&*res.first == &items[2]);
+        REQUIRE(byId.size() == 20U);
+        REQUIRE_FALSE(dup.byId.isLinked());
+    }
+
+    SECTION("unlink from one container only") {
+
+        REQUIRE(items[3].byId.isLinked());
+        REQUIRE(byId.erase(21) == 1U);
+        REQUIRE(byId.erase(21) == 0U);
+        REQUIRE_FALSE(items[3].byId.isLinked());
+
+        REQUIRE(byId.size() == 19U);
+        REQUIRE(byId.find(21) == byId.end());
+        REQUIRE(order.size() == 20U);
+        REQUIRE(items[3].byState.isLinked());
+
+        odd.erase(StateList::iterator_to(items[3]));
+        REQUIRE(odd.size() == 9U);
+        REQUIRE(&*OrderList::iterator_to(items[3]) == &items[3]);
+    }
+
+    SECTION("rehash()") {
+
+        byId.rehash(bigger);
+
+        REQUIRE(byId.bucket_count() == 32U);
+        REQUIRE(byId.size() == 20U);
+
+        int cnt = 0;
+        for (const auto& item : byId) {
+            REQUIRE(byId.find(item.id) == IdSet::iterator_to(item));
+            ++cnt;
+        }
+
+        REQUIRE(cnt == 20);
+    }
+
+    SECTION("iteration covers all elements") {
+
+        int sum = 0;
+        for (auto& item : byId) {
+            sum += item.value;
+        }
+
+        REQUIRE(sum == (19 * 20) / 2);
+    }
+
+    byId.clear();
+    odd.clear();
+    order.clear();
+
+    REQUIRE(byId.empty());
+    REQUIRE(byId.find(35) == byId.end());
+    REQUIRE(std::none_of(items.begin(), items.end(), [](const Item& item) {
+        return item.byId.isLinked();
+    }));
+}
+
+TEST_CASE("Etl::Intrusive::List<> with HookOffset<> specialization", "[intrusive][list][etl]") {
+
+    Tagged items[3] {{1, {}}, {2, {}}, {3, {}}};
+
+    Etl::Intrusive::List<Tagged, &Tagged::hook> list;
+    for (auto& item : items) {
+        list.push_front(item);
+    }
+
+    REQUIRE(&list.front() == &items[2]);
+    REQUIRE(list.back().tag == 1);
+
+    list.clear();
+    REQUIRE_FALSE(items[0].hook.isLinked());
+}
+
+}  // namespace
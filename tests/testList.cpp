@@ -23,8 +23,11 @@ limitations under the License.
 
 #include <etl/List.h>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "AtScopeEnd.h"
 #include "ContainerTester.h"
@@ -251,6 +254,40 @@ TEMPLATE_TEST_CASE("Etl::List<> leak test",
 }
 
 
+template<class ListT>
+void testListEraseIf() {
+
+    ListT list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(ContainerTester(i));
+    }
+
+    auto cnt = Etl::erase_if(list, [](const ContainerTester& item) {
+        return (item.getValue() % 3) == 0;
+    });
+
+    REQUIRE(cnt == 4U);
+    REQUIRE(list.size() == 6U);
+    REQUIRE(ContainerTester::getObjectCount() == 6U);
+    REQUIRE(list.front() == ContainerTester(1));
+    REQUIRE(list.back() == ContainerTester(8));
+
+    for (const auto& item : list) {
+        REQUIRE((item.getValue() % 3) != 0);
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Etl::List<> erase_if test",
+                   "[list][etl]",
+                   (Etl::Dynamic::List<ContainerTester>),
+                   (Etl::Static::List<ContainerTester, 16U>),
+                   (Etl::Pooled::List<ContainerTester, 16U>)) {
+
+    testListEraseIf<TestType>();
+}
+
+
 template<class ListT>
 void testListCopy() {
 
@@ -315,6 +352,59 @@ TEMPLATE_TEST_CASE("Etl::List<> copy",
 }
 
 
+template<class ListT>
+void testListInsertWithMove() {
+
+    ListT list;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    list.push_back(ContainerTester(-1));
+    list.push_front(ContainerTester(-2));
+    list.insert(list.end(), ContainerTester(-3));
+
+    ContainerTester item(-4);
+    list.emplace_back(std::move(item));
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(list.size() == 4);
+    auto it = list.begin();
+    REQUIRE(*it == ContainerTester(-2));
+    REQUIRE(*(++it) == ContainerTester(-1));
+    REQUIRE(*(++it) == ContainerTester(-3));
+    REQUIRE(*(++it) == ContainerTester(-4));
+}
+
+
+TEMPLATE_TEST_CASE("Etl::List<> insert with move",
+                   "[list][etl]",
+                   (Etl::Dynamic::List<ContainerTester>),
+                   (Etl::Static::List<ContainerTester, 32U>),
+                   (Etl::Pooled::List<ContainerTester, 32U>)) {
+
+    testListInsertWithMove<TestType>();
+}
+
+
+TEST_CASE("Etl::List<> with move-only type", "[list][etl]") {
+
+    using Item = std::unique_ptr<int>;
+    Etl::Dynamic::List<Item> list;
+
+    list.push_back(Item {new int {1}});
+    list.push_front(Item {new int {2}});
+    list.emplace_back(new int {3});
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(*list.front() == 2);
+    REQUIRE(*list.back() == 3);
+
+    list.pop_front();
+    REQUIRE(*list.front() == 1);
+}
+
+
 template<class ListT>
 void testSwapIsNoCopy() {
 
@@ -658,6 +748,208 @@ TEST_CASE("Etl::Pooled::List<>::splice() test", "[list][etl]") {
 }
 
 
+TEMPLATE_TEST_CASE("Etl::List<>::splice() relinks nodes",
+                   "[list][etl]",
+                   (Etl::Dynamic::List<ContainerTester>),
+                   (Etl::Pooled::List<ContainerTester, 32>)) {
+
+    TestType list1;
+    TestType list2;
+
+    for (int i = 0; i < 8; ++i) {
+        list1.push_back(ContainerTester(i));
+        list2.push_back(ContainerTester(i + 10));
+    }
+
+    const ContainerTester* addr = &*(++list2.begin());
+    const auto copyCnt = ContainerTester::getCopyCount();
+    const auto moveCnt = ContainerTester::getMoveCount();
+
+    SECTION("range with length") {
+
+        auto first = ++list2.begin();
+        auto last = first;
+        std::advance(last, 3);
+
+        list1.splice(++list1.begin(), list2, first, last, 3U);
+
+        REQUIRE(list1.size() == 11U);
+        REQUIRE(list2.size() == 5U);
+        REQUIRE(&*(++list1.begin()) == addr);
+        REQUIRE(*std::next(list1.begin(), 3) == ContainerTester(13));
+        REQUIRE(*std::next(list1.begin(), 4) == ContainerTester(1));
+        REQUIRE(*std::next(list2.begin(), 1) == ContainerTester(14));
+    }
+
+    SECTION("whole list") {
+
+        list1.splice(list1.begin(), list2);
+
+        REQUIRE(list1.size() == 16U);
+        REQUIRE(list2.empty());
+        REQUIRE(list1.front() == ContainerTester(10));
+        REQUIRE(list1.back() == ContainerTester(7));
+        REQUIRE(&*(++list1.begin()) == addr);
+    }
+
+    SECTION("empty range") {
+
+        list1.splice(list1.end(), list2, list2.begin(), list2.begin());
+
+        REQUIRE(list1.size() == 8U);
+        REQUIRE(list2.size() == 8U);
+    }
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::List<> sort(), merge(), unique(), reverse()",
+                   "[list][etl]",
+                   (Etl::Dynamic::List<ContainerTester>),
+                   (Etl::Static::List<ContainerTester, 64>),
+                   (Etl::Pooled::List<ContainerTester, 64>)) {
+
+    const int values[] = {5, 3, 9, 1, 7, 3, 8, 2, 2, 6, 0, 4};
+
+    TestType list;
+    for (int v : values) {
+        list.push_back(ContainerTester(v));
+    }
+
+    std::vector<const ContainerTester*> addresses;
+    for (const auto& item : list) {
+        addresses.push_back(&item);
+    }
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+    const auto moveCnt = ContainerTester::getMoveCount();
+
+    SECTION("sort()") {
+
+        list.sort();
+
+        REQUIRE(list.size() == 12U);
+        REQUIRE(std::is_sorted(list.begin(), list.end()));
+
+        std::vector<const ContainerTester*> sortedAddresses;
+        for (const auto& item : list) {
+            sortedAddresses.push_back(&item);
+        }
+
+        REQUIRE(std::is_permutation(
+            addresses.begin(), addresses.end(), sortedAddresses.begin()));
+
+        // stable: the first '3' stays before the second one
+        auto first3 = std::find(list.begin(), list.end(), ContainerTester(3));
+        REQUIRE(&*first3 == addresses[1]);
+
+        std::vector<int> reversed;
+        list.reverse();
+        for (const auto& item : list) {
+            reversed.push_back(item.getValue());
+        }
+
+        REQUIRE(std::is_sorted(reversed.rbegin(), reversed.rend()));
+        REQUIRE(list.front() == ContainerTester(9));
+        REQUIRE(list.back() == ContainerTester(0));
+    }
+
+    SECTION("sort() with comparator") {
+
+        list.sort([](const ContainerTester& a, const ContainerTester& b) { return b < a; });
+        REQUIRE(list.front() == ContainerTester(9));
+        REQUIRE(list.back() == ContainerTester(0));
+    }
+
+    SECTION("unique()") {
+
+        list.sort();
+        REQUIRE(list.unique() == 2U);
+        REQUIRE(list.size() == 10U);
+        REQUIRE(std::adjacent_find(list.begin(), list.end()) == list.end());
+        REQUIRE(ContainerTester::getObjectCount() == 10);
+    }
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::List<>::merge() relinks nodes",
+                   "[list][etl]",
+                   (Etl::Dynamic::List<ContainerTester>),
+                   (Etl::Pooled::List<ContainerTester, 64>)) {
+
+    TestType list;
+    for (int v : {0, 2, 3, 5, 8}) {
+        list.push_back(ContainerTester(v));
+    }
+
+    TestType other;
+    for (int v : {-1, 3, 10, 11}) {
+        other.push_back(ContainerTester(v));
+    }
+
+    const ContainerTester* other3 = &*(++other.begin());
+    const auto copyCnt = ContainerTester::getCopyCount();
+    const auto moveCnt = ContainerTester::getMoveCount();
+
+    list.merge(other);
+
+    REQUIRE(other.empty());
+    REQUIRE(list.size() == 9U);
+    REQUIRE(std::is_sorted(list.begin(), list.end()));
+    REQUIRE(list.front() == ContainerTester(-1));
+    REQUIRE(list.back() == ContainerTester(11));
+
+    // merged equal elements follow the ones of the target
+    auto it = std::find(list.begin(), list.end(), ContainerTester(3));
+    ++it;
+    REQUIRE(&*it == other3);
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+}
+
+
+TEST_CASE("Etl::List<>::merge() with different allocators", "[list][etl]") {
+
+    Etl::Dynamic::List<int> list {1, 3, 5, 7};
+    Etl::Static::List<int, 8> other {0, 3, 4, 9};
+
+    list.merge(other);
+
+    REQUIRE(other.empty());
+    REQUIRE(list == Etl::Dynamic::List<int> {0, 1, 3, 3, 4, 5, 7, 9});
+}
+
+
+TEST_CASE("Etl::List<>::sort() with many elements", "[list][etl]") {
+
+    Etl::Dynamic::List<int> list;
+    std::vector<int> ref;
+
+    unsigned seed = 7U;
+    for (int i = 0; i < 1000; ++i) {
+        seed = (seed * 1103515245U) + 12345U;
+        const int v = static_cast<int>((seed >> 16U) % 100U);
+        list.push_back(v);
+        ref.push_back(v);
+    }
+
+    list.sort();
+    std::sort(ref.begin(), ref.end());
+
+    REQUIRE(list.size() == 1000U);
+    REQUIRE(std::equal(list.begin(), list.end(), ref.begin()));
+
+    list.reverse();
+    REQUIRE(std::equal(list.begin(), list.end(), ref.rbegin()));
+}
+
+
 TEST_CASE("Etl::Custom::List<> allocator test", "[list][etl]") {
 
     using ItemType = ContainerTester;
@@ -768,6 +1060,45 @@ TEST_CASE("Etl::Static::List<> test", "[list][etl]") {
 }
 
 
+TEST_CASE("Etl::Static::List<> clear() resets the pool", "[list][etl]") {
+
+    static const uint32_t NUM = 8;
+
+    SECTION("trivially destructible") {
+
+        Etl::Static::List<int, NUM> list {1, 2, 3, 4, 5};
+        list.erase(++list.begin());
+        REQUIRE(list.getAllocator().size() == 4U);
+
+        list.clear();
+
+        REQUIRE(list.empty());
+        REQUIRE(list.getAllocator().size() == 0U);
+
+        for (int i = 0; i < static_cast<int>(NUM); ++i) {
+            list.push_back(i);
+        }
+
+        REQUIRE(list.size() == NUM);
+        REQUIRE(list.front() == 0);
+        REQUIRE(list.back() == (NUM - 1));
+    }
+
+    SECTION("non-trivially destructible") {
+
+        Etl::Static::List<ContainerTester, NUM> list;
+        list.push_back(ContainerTester(1));
+        list.push_back(ContainerTester(2));
+
+        list.clear();
+
+        REQUIRE(list.empty());
+        REQUIRE(list.getAllocator().size() == 0U);
+        REQUIRE(ContainerTester::getObjectCount() == 0);
+    }
+}
+
+
 TEST_CASE("Etl::Pooled::List<> test", "[list][etl]") {
 
     static const uint32_t NUM = 16;
@@ -924,4 +1255,92 @@ TEST_CASE("Etl::List<reference_wrapper<T>> tests", "[list][comp][etl]") {
     REQUIRE(i0 == -1);
 }
 
+
+struct ThrowOnCopy {
+
+    static int copiesLeft;
+
+    int value;
+
+    explicit ThrowOnCopy(int v) :
+        value(v) {}
+
+    ThrowOnCopy(const ThrowOnCopy& other) :
+        value(other.value) {
+        if (copiesLeft == 0) {
+            throw std::runtime_error("copy");
+        }
+        --copiesLeft;
+    }
+};
+
+int ThrowOnCopy::copiesLeft = 0;
+
+
+TEST_CASE("Etl::List<> bulk insert releases nodes on throw", "[list][etl]") {
+
+    using ListT = Etl::Pooled::List<ThrowOnCopy, 8U>;
+
+    ListT list;
+    list.emplace_back(1);
+
+    ThrowOnCopy::copiesLeft = 2;
+    REQUIRE_THROWS(list.insert(list.end(), 5U, ThrowOnCopy(2)));
+    REQUIRE(list.size() == 3U);
+
+    ThrowOnCopy::copiesLeft = 5;
+    list.insert(list.end(), 5U, ThrowOnCopy(3));
+    REQUIRE(list.size() == 8U);
+    REQUIRE(list.back().value == 3);
+}
+
+
+TEST_CASE("Etl::List<> sort() and merge() keep the nodes on throw", "[list][etl]") {
+
+    using ListT = Etl::Dynamic::List<int>;
+
+    int callsLeft = 0;
+    auto comp = [&callsLeft](int a, int b) {
+        if (callsLeft == 0) {
+            throw std::runtime_error("compare");
+        }
+        --callsLeft;
+        return a < b;
+    };
+
+    auto sorted = [](const ListT& l) {
+        std::vector<int> res(l.begin(), l.end());
+        std::sort(res.begin(), res.end());
+        return res;
+    };
+
+    SECTION("sort()") {
+
+        for (int calls = 0; calls < 25; calls += 3) {
+
+            ListT list {9, 3, 7, 1, 8, 2, 6, 4, 5, 0, 11, 10};
+            const auto expected = sorted(list);
+
+            callsLeft = calls;
+            REQUIRE_THROWS(list.sort(comp));
+            REQUIRE(list.size() == 12U);
+            REQUIRE(static_cast<std::size_t>(std::distance(list.begin(), list.end())) == 12U);
+            REQUIRE(sorted(list) == expected);
+        }
+    }
+
+    SECTION("merge()") {
+
+        ListT list {1, 3, 5, 7};
+        ListT other {2, 4, 6};
+
+        callsLeft = 3;
+        REQUIRE_THROWS(list.merge(other, comp));
+        REQUIRE(list.size() + other.size() == 7U);
+        REQUIRE(static_cast<std::size_t>(std::distance(list.begin(), list.end())) == list.size());
+        REQUIRE(static_cast<std::size_t>(std::distance(other.begin(), other.end()))
+                == other.size());
+    }
+}
+
 }  // namespace
@@ -24,6 +24,8 @@ limitations under the License.
 #include <etl/Map.h>
 
 #include <iterator>
+#include <memory>
+#include <string>
 
 #include "AtScopeEnd.h"
 #include "ContainerTester.h"
@@ -194,6 +196,46 @@ TEST_CASE("Etl::Dynamic::Map<> emplace test", "[map][etl]") {
 }
 
 
+TEST_CASE("Etl::Map<> insert with move", "[map][etl]") {
+
+    using MapType = Etl::Dynamic::Map<int, ContainerTester>;
+    MapType map;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    map.insert(MapType::value_type(1, ContainerTester(-1)));
+    map.insert_or_assign(2, ContainerTester(-2));
+    map.insert_or_assign(2, ContainerTester(-3));
+    map.emplace(3, ContainerTester(-4));
+    map[4] = ContainerTester(-5);
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(map.size() == 4);
+    REQUIRE(map[1] == ContainerTester(-1));
+    REQUIRE(map[2] == ContainerTester(-3));
+    REQUIRE(map[3] == ContainerTester(-4));
+    REQUIRE(map[4] == ContainerTester(-5));
+}
+
+
+TEST_CASE("Etl::Map<> with move-only type", "[map][etl]") {
+
+    using Item = std::unique_ptr<int>;
+    Etl::Dynamic::Map<std::string, Item> map;
+
+    std::string key {"one"};
+    map.emplace(std::move(key), Item {new int {1}});
+    map.insert_or_assign("two", Item {new int {2}});
+    map["three"] = Item {new int {3}};
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(*map["one"] == 1);
+    REQUIRE(*map["two"] == 2);
+    REQUIRE(*map["three"] == 3);
+}
+
+
 TEST_CASE("Etl::Dynamic::Map<> erase tests", "[map][etl]") {
 
     typedef Etl::Dynamic::Map<int, int32_t> MapType;
@@ -226,6 +268,19 @@ TEST_CASE("Etl::Dynamic::Map<> erase tests", "[map][etl]") {
         REQUIRE(map.find(2) == map.end());
         REQUIRE(it == map.find(3));
     }
+
+    SECTION("erase_if()") {
+
+        auto cnt = Etl::erase_if(map, [](const MapType::value_type& item) {
+            return (item.first % 2) == 0;
+        });
+
+        REQUIRE(cnt == 2);
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.find(2) == map.end());
+        REQUIRE(map.find(4) == map.end());
+        REQUIRE(map.find(3) != map.end());
+    }
 }
 
 
@@ -594,6 +649,32 @@ TEST_CASE("Etl::Custom::Map<> allocator test", "[map][etl]") {
 }
 
 
+TEST_CASE("Etl::Static::Map<> clear() resets the pool", "[map][etl]") {
+
+    static const uint32_t NUM = 16;
+    typedef Etl::Static::Map<uint32_t, int, NUM> MapType;
+
+    MapType map;
+
+    for (uint32_t round = 0; round < 3; ++round) {
+
+        for (uint32_t i = 0; i < NUM; ++i) {
+            map.insert(i, static_cast<int>(i + round));
+        }
+
+        REQUIRE(map.size() == NUM);
+        REQUIRE(map.getAllocator().size() == NUM);
+        REQUIRE(map[NUM - 1] == static_cast<int>(NUM - 1 + round));
+
+        map.clear();
+
+        REQUIRE(map.empty());
+        REQUIRE(map.getAllocator().size() == 0U);
+        REQUIRE(map.find(1) == map.end());
+    }
+}
+
+
 TEST_CASE("Etl::Pooled::Map<> test", "[map][etl]") {
 
     static const uint32_t NUM = 16;
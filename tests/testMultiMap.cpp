@@ -158,6 +158,27 @@ TEST_CASE("Etl::Dynamic::MultiMap<> insert test", "[multimap][etl]") {
 }
 
 
+TEST_CASE("Etl::MultiMap<> insert with move", "[multimap][etl]") {
+
+    using MapType = Etl::Dynamic::MultiMap<int, ContainerTester>;
+    MapType map;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    map.insert(MapType::value_type(1, ContainerTester(-1)));
+    map.insert(MapType::value_type(1, ContainerTester(-2)));
+    map.emplace(2, ContainerTester(-3));
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(map.size() == 3);
+    auto it = map.begin();
+    REQUIRE(it->second == ContainerTester(-1));
+    REQUIRE((++it)->second == ContainerTester(-2));
+    REQUIRE((++it)->second == ContainerTester(-3));
+}
+
+
 TEST_CASE("Etl::Dynamic::MultiMap<> erase tests", "[multimap][etl]") {
 
     typedef Etl::Dynamic::MultiMap<int, int32_t> MapType;
@@ -192,6 +213,19 @@ TEST_CASE("Etl::Dynamic::MultiMap<> erase tests", "[multimap][etl]") {
         REQUIRE(map.size() == 5);
         REQUIRE(map.find(2) != map.end());
     }
+
+    SECTION("erase_if()") {
+
+        auto cnt = Etl::erase_if(map, [](const MapType::value_type& item) {
+            return (item.first % 2) == 0;
+        });
+
+        REQUIRE(cnt == 4);
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.find(2) == map.end());
+        REQUIRE(map.find(4) == map.end());
+        REQUIRE(map.find(3) != map.end());
+    }
 }
 
 
@@ -21,14 +21,25 @@ limitations under the License.
 
 #include <catch2/catch.hpp>
 
+#include <etl/AtomicMemoryPool.h>
+#include <etl/BitmapMemoryPool.h>
+#include <etl/GrowingPoolAllocator.h>
 #include <etl/List.h>
 #include <etl/MemoryPool.h>
 #include <etl/PoolAllocator.h>
+#include <etl/PoolRegistry.h>
 #include <etl/UnorderedSet.h>
 #include <etl/Vector.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <cstring>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <vector>
 
 namespace {
 
@@ -176,6 +187,293 @@ TEST_CASE("Etl::MemoryPool<> random access", "[pool][etl]") {
 }
 
 
+struct alignas(32) OverAligned {
+    double data[3];
+};
+
+bool isAligned(const void* ptr, std::size_t alignment) {
+    return (reinterpret_cast<std::uintptr_t>(ptr) % alignment) == 0U;
+}
+
+
+TEST_CASE("Etl::MemoryPool<> alignment", "[pool][etl]") {
+
+    SECTION("default alignment") {
+
+        Etl::MemoryPool<1, 8> pool;
+        REQUIRE(pool.alignment() == alignof(std::uint64_t));
+
+        for (std::size_t i = 0; i < pool.capacity(); ++i) {
+            REQUIRE(isAligned(pool.pop(), alignof(std::uint64_t)));
+        }
+    }
+
+    SECTION("over-aligned") {
+
+        Etl::MemoryPool<24, 8, 64> pool;
+        REQUIRE(pool.alignment() == 64U);
+
+        for (std::size_t i = 0; i < pool.capacity(); ++i) {
+            REQUIRE(isAligned(pool.pop(), 64U));
+        }
+    }
+}
+
+
+TEST_CASE("Etl::MemoryPool<> over dirty storage", "[pool][etl]") {
+
+    // The pool storage is not initialized, so the pool has to work
+    // on any prior content of the memory.
+    using PoolT = Etl::MemoryPool<16, 8>;
+    alignas(PoolT) std::uint8_t raw[sizeof(PoolT)];
+    std::memset(raw, 0xA5, sizeof(raw));
+
+    auto* pool = new (raw) PoolT {};
+    REQUIRE(pool->getFreeCount() == 8U);
+
+    void* items[8];
+    for (auto& item : items) {
+        item = pool->pop();
+        REQUIRE(item != nullptr);
+    }
+
+    REQUIRE(pool->pop() == nullptr);
+    for (std::size_t i = 1U; i < 8U; ++i) {
+        REQUIRE(items[i] != items[i - 1U]);
+    }
+
+    REQUIRE(pool->push(items[3]));
+    REQUIRE(pool->pop() == items[3]);
+
+    pool->~PoolT();
+}
+
+
+TEST_CASE("Etl::AtomicMemoryPool<> basic test", "[pool][etl]") {
+
+    Etl::AtomicMemoryPool<16, 4> pool;
+
+    REQUIRE(pool.capacity() == 4U);
+    REQUIRE(pool.getFreeCount() == 4U);
+
+    void* items[4] {};
+    for (auto& item : items) {
+        item = pool.pop();
+        REQUIRE(item != nullptr);
+    }
+
+    REQUIRE(pool.pop() == nullptr);
+    REQUIRE(pool.getCount() == 4U);
+    REQUIRE(items[0] != items[1]);
+
+    int dummy = 0;
+    REQUIRE_FALSE(pool.push(&dummy));
+
+    REQUIRE(pool.push(items[1]));
+    REQUIRE(pool.push(items[3]));
+    REQUIRE(pool.getFreeCount() == 2U);
+
+    REQUIRE(pool.pop() == items[3]);
+    REQUIRE(pool.pop() == items[1]);
+    REQUIRE(pool.pop() == nullptr);
+
+    for (auto& item : items) {
+        REQUIRE(pool.push(item));
+    }
+
+    REQUIRE(pool.getFreeCount() == 4U);
+}
+
+
+TEST_CASE("Etl::BitmapMemoryPool<> basic test", "[pool][etl]") {
+
+    Etl::BitmapMemoryPool<16, 8> pool;
+
+    REQUIRE(pool.capacity() == 8U);
+    REQUIRE(pool.getFreeCount() == 8U);
+
+    void* items[8];
+    for (auto& item : items) {
+        item = pool.pop();
+        REQUIRE(item != nullptr);
+    }
+
+    REQUIRE(pool.pop() == nullptr);
+    REQUIRE(pool.getCount() == 8U);
+    for (std::size_t i = 1U; i < 8U; ++i) {
+        REQUIRE(items[i] > items[i - 1U]);
+    }
+
+    SECTION("lowest address first") {
+
+        REQUIRE(pool.push(items[2]));
+        REQUIRE(pool.push(items[6]));
+        REQUIRE(pool.push(items[4]));
+        REQUIRE(pool.getFreeCount() == 3U);
+
+        REQUIRE(pool.pop() == items[2]);
+        REQUIRE(pool.pop() == items[4]);
+        REQUIRE(pool.pop() == items[6]);
+    }
+
+    SECTION("free fail") {
+
+        REQUIRE(pool.push(items[1]));
+        REQUIRE_FALSE(pool.push(items[1]));
+
+        int dummy = 0;
+        REQUIRE_FALSE(pool.push(&dummy));
+        REQUIRE_FALSE(pool.push(static_cast<std::uint8_t*>(items[2]) + 1U));
+        REQUIRE(pool.getFreeCount() == 1U);
+    }
+
+    SECTION("reset") {
+
+        pool.reset();
+        REQUIRE(pool.getFreeCount() == 8U);
+        REQUIRE(pool.pop() == items[0]);
+    }
+}
+
+
+TEST_CASE("Etl::BitmapMemoryPool<> runs and occupancy scan", "[pool][etl]") {
+
+    static const std::size_t NUM = 150U;
+    Etl::BitmapMemoryPool<8, NUM> pool;
+
+    auto ixOf = [&pool](void* ptr) {
+        return static_cast<std::size_t>(static_cast<std::uint8_t*>(ptr)
+                                        - static_cast<std::uint8_t*>(pool.getItemPointer(0U)))
+               / 8U;
+    };
+
+    void* first = pool.pop(60U);
+    REQUIRE(first == pool.getItemPointer(0U));
+
+    void* second = pool.pop(10U);
+    REQUIRE(ixOf(second) == 60U);
+
+    void* third = pool.pop(70U);
+    REQUIRE(ixOf(third) == 70U);
+
+    REQUIRE(pool.getFreeCount() == 10U);
+    REQUIRE(pool.pop(11U) == nullptr);
+
+    REQUIRE(pool.push(second, 10U));
+    REQUIRE(pool.findFree(0U) == 60U);
+    REQUIRE(pool.findUsed(60U) == 70U);
+
+    // 10 free at 60, 10 free at 140
+    REQUIRE(pool.pop(12U) == nullptr);
+    REQUIRE(ixOf(pool.pop(4U)) == 60U);
+    REQUIRE(ixOf(pool.pop(8U)) == 140U);
+
+    SECTION("partial release") {
+
+        REQUIRE(pool.push(pool.getItemPointer(10U), 5U));
+        REQUIRE_FALSE(pool.push(pool.getItemPointer(8U), 5U));
+        REQUIRE_FALSE(pool.push(pool.getItemPointer(148U), 5U));
+        REQUIRE(pool.pop() == pool.getItemPointer(10U));
+    }
+
+    SECTION("occupancy scan") {
+
+        std::size_t used = 0U;
+        for (std::size_t ix = pool.findUsed(0U); ix < pool.capacity();
+             ix = pool.findUsed(ix + 1U)) {
+            REQUIRE(pool.isUsed(ix));
+            ++used;
+        }
+
+        REQUIRE(used == pool.getCount());
+        REQUIRE_FALSE(pool.isUsed(64U));
+        REQUIRE(pool.isUsed(63U));
+        REQUIRE_FALSE(pool.isUsed(NUM));
+    }
+}
+
+
+TEST_CASE("Etl::PoolAllocator with AddressOrdered", "[poolallocator][etl]") {
+
+    Etl::PoolAllocator<std::uint64_t, 16U, Etl::AddressOrdered<>> allocator;
+
+    std::uint64_t* run = allocator.allocate(4U);
+    REQUIRE(run != nullptr);
+    REQUIRE(allocator.size() == 4U);
+
+    std::uint64_t* item = allocator.allocate(1U);
+    REQUIRE(item == (run + 4U));
+
+    allocator.deallocate(run, 4U);
+    REQUIRE(allocator.size() == 1U);
+    REQUIRE(allocator.allocate(1U) == run);
+}
+
+
+template<class T>
+using OrderedPoolAllocator = Etl::CommonPoolAllocator<T, 32U, Etl::AddressOrdered<std::mutex>>;
+
+TEST_CASE("Etl::List<> with address ordered pool", "[poolallocator][list][etl]") {
+
+    using ListType = Etl::Custom::List<int, OrderedPoolAllocator>;
+
+    ListType list;
+    for (int i = 0; i < 16; ++i) {
+        list.push_back(i);
+    }
+
+    list.remove_if([](int v) { return (v % 3) == 0; });
+    for (int i = 16; i < 22; ++i) {
+        list.push_back(i);
+    }
+
+    // The released nodes are reused in address order
+    const int* prev = nullptr;
+    for (const auto& v : list) {
+        if (v >= 16) {
+            REQUIRE(((prev == nullptr) || (&v > prev)));
+            prev = &v;
+        }
+    }
+
+    REQUIRE(list.size() == 16U);
+    list.clear();
+    REQUIRE(list.getAllocator().size() == 0U);
+}
+
+
+TEST_CASE("Etl::PoolAllocator alignment", "[poolallocator][etl]") {
+
+    SECTION("over-aligned type") {
+
+        Etl::PoolHelperForSize<8>::Allocator<OverAligned> pool;
+        for (std::size_t i = 0; i < pool.max_size(); ++i) {
+            REQUIRE(isAligned(pool.allocate(1), alignof(OverAligned)));
+        }
+    }
+
+    SECTION("over-aligned items") {
+
+        Etl::PoolAllocator<int, 8, Etl::Detail::NullLock, 64> pool;
+        for (std::size_t i = 0; i < pool.max_size(); ++i) {
+            REQUIRE(isAligned(pool.allocate(1), 64U));
+        }
+    }
+
+    SECTION("node containers") {
+
+        Etl::Static::List<OverAligned, 8> list;
+        for (std::size_t i = 0; i < list.max_size(); ++i) {
+            list.push_back(OverAligned {});
+        }
+
+        for (const auto& item : list) {
+            REQUIRE(isAligned(&item, alignof(OverAligned)));
+        }
+    }
+}
+
+
 TEST_CASE("Etl::PoolAllocator basic tests", "[poolallocator][etl]") {
 
     static const std::size_t SIZE {16U};
@@ -208,6 +506,125 @@ TEST_CASE("Etl::PoolAllocator basic tests", "[poolallocator][etl]") {
 }
 
 
+struct CountingLock {
+
+    static std::size_t lockCnt;
+
+    void lock() noexcept {
+        ++lockCnt;
+    }
+
+    void unlock() noexcept {}
+};
+
+std::size_t CountingLock::lockCnt {0U};
+
+template<class T>
+using CountingPoolAllocator = Etl::PoolAllocator<T, 64U, CountingLock>;
+
+
+TEST_CASE("Etl::PoolAllocator bulk allocation", "[poolallocator][etl]") {
+
+    static const std::size_t SIZE {16U};
+    Etl::PoolAllocator<int, SIZE, CountingLock> pool;
+
+    int* ptrs[SIZE + 4U] {};
+
+    CountingLock::lockCnt = 0U;
+    REQUIRE(pool.allocate_bulk(10U, ptrs) == 10U);
+    REQUIRE(CountingLock::lockCnt == 1U);
+    REQUIRE(pool.size() == 10U);
+
+    CountingLock::lockCnt = 0U;
+    REQUIRE(pool.allocate_bulk(10U, ptrs + 10U) == 6U);
+    REQUIRE(CountingLock::lockCnt == 1U);
+    REQUIRE(pool.size() == SIZE);
+
+    Etl::Dynamic::UnorderedSet<int*> uniqueElements;
+    uniqueElements.insert(std::begin(ptrs), std::begin(ptrs) + SIZE);
+    REQUIRE(uniqueElements.size() == SIZE);
+
+    CountingLock::lockCnt = 0U;
+    pool.deallocate_bulk(ptrs, SIZE);
+    REQUIRE(CountingLock::lockCnt == 1U);
+    REQUIRE(pool.size() == 0U);
+}
+
+
+TEST_CASE("Etl::List<> uses bulk allocation", "[poolallocator][list][etl]") {
+
+    Etl::Custom::List<int, CountingPoolAllocator> list;
+    CountingLock::lockCnt = 0U;
+
+    SECTION("insert(pos, n, value)") {
+
+        auto it = list.insert(list.cbegin(), 40U, 5);
+
+        REQUIRE(it == list.begin());
+        REQUIRE(list.size() == 40U);
+        REQUIRE(CountingLock::lockCnt == 3U);
+    }
+
+    SECTION("assign(first, last)") {
+
+        const Etl::Dynamic::Vector<int> src(20U, 7);
+        list.assign(src.begin(), src.end());
+
+        REQUIRE(list.size() == 20U);
+        REQUIRE(list.front() == 7);
+        REQUIRE(CountingLock::lockCnt == 2U);
+    }
+
+    SECTION("exhausted pool") {
+
+        list.insert(list.cbegin(), 70U, 1);
+
+        REQUIRE(list.size() == 64U);
+    }
+
+    SECTION("remove_if()") {
+
+        list.insert(list.cbegin(), 40U, 1);
+        list.insert(list.cbegin(), 10U, 2);
+
+        CountingLock::lockCnt = 0U;
+        REQUIRE(list.remove_if([](int item) { return item == 1; }) == 40U);
+
+        REQUIRE(list.size() == 10U);
+        REQUIRE(CountingLock::lockCnt == 3U);
+    }
+
+    CountingLock::lockCnt = 0U;
+    list.clear();
+
+    REQUIRE(list.empty());
+    REQUIRE(CountingLock::lockCnt <= 4U);
+    REQUIRE(list.getAllocator().size() == 0U);
+}
+
+
+TEST_CASE("Etl::UnorderedSet<> releases nodes in bulks", "[poolallocator][unorderedset][etl]") {
+
+    Etl::Custom::UnorderedSet<int, CountingPoolAllocator, std::allocator> set;
+
+    for (int i = 0; i < 40; ++i) {
+        set.insert(i);
+    }
+
+    CountingLock::lockCnt = 0U;
+    REQUIRE(Etl::erase_if(set, [](int item) { return item < 20; }) == 20U);
+
+    REQUIRE(set.size() == 20U);
+    REQUIRE(CountingLock::lockCnt == 2U);
+
+    CountingLock::lockCnt = 0U;
+    set.clear();
+
+    REQUIRE(set.empty());
+    REQUIRE(CountingLock::lockCnt == 2U);
+}
+
+
 TEST_CASE("Etl::CommonPoolAllocator basic tests", "[poolallocator][etl]") {
 
     static const std::size_t SIZE {16U};
@@ -291,4 +708,395 @@ TEST_CASE("Etl::CommonPoolAllocator concurrency test", "[poolallocator][etl]") {
     REQUIRE(uniqueElements.size() == SIZE);
 }
 
+
+TEST_CASE("Etl::CommonPoolAllocator lock-free concurrency test", "[poolallocator][etl]") {
+
+    static const std::size_t NUM_THREADS {8U};
+    static const std::size_t SIZE {64U};
+    static const std::size_t ROUNDS {20000U};
+
+    using Allocator = Etl::CommonPoolAllocator<std::size_t, SIZE, Etl::LockFree>;
+
+    std::atomic<std::size_t> errors {0U};
+
+    auto proc = [&errors](std::size_t id) {
+        Allocator pool;
+        std::size_t* items[4] {};
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            for (auto& p : items) {
+                p = pool.allocate(1);
+                if (p != nullptr) {
+                    *p = id;
+                }
+            }
+            for (auto& p : items) {
+                if (p != nullptr) {
+                    if (*p != id) {
+                        ++errors;
+                    }
+                    pool.deallocate(p, 1);
+                }
+            }
+        }
+    };
+
+    Etl::Dynamic::List<std::thread> threads;
+    for (std::size_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back(proc, i);
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    REQUIRE(errors == 0U);
+    REQUIRE(Allocator().size() == 0U);
+}
+
+
+TEST_CASE("Etl::CachedPoolAllocator basic tests", "[poolallocator][etl]") {
+
+    using Allocator = Etl::CachedPoolAllocator<int, 16, 4, CountingLock>;
+
+    Allocator alloc;
+    REQUIRE(alloc.max_size() == 16U);
+    REQUIRE(alloc.size() == 0U);
+    REQUIRE(alloc.reserve() == 16U);
+
+    CountingLock::lockCnt = 0U;
+    int* items[16] {};
+    for (auto& item : items) {
+        item = alloc.allocate(1);
+        REQUIRE(item != nullptr);
+    }
+
+    REQUIRE(CountingLock::lockCnt == 8U);
+    REQUIRE(alloc.size() == 16U);
+    REQUIRE(alloc.reserve() == 0U);
+    REQUIRE(alloc.allocate(1) == nullptr);
+
+    alloc.deallocate(items[0], 1);
+    REQUIRE(alloc.size() == 15U);
+    REQUIRE(alloc.reserve() == 1U);
+    REQUIRE(alloc.allocate(1) == items[0]);
+
+    for (auto& item : items) {
+        alloc.deallocate(item, 1);
+    }
+
+    REQUIRE(alloc.size() == 0U);
+    REQUIRE(Allocator().handle() == alloc.handle());
+
+    Allocator::flush();
+    REQUIRE(alloc.size() == 0U);
+    REQUIRE(alloc.reserve() == 16U);
+}
+
+
+TEST_CASE("Etl::CachedPoolAllocator concurrency test", "[poolallocator][etl]") {
+
+    static const std::size_t NUM_THREADS {8U};
+    static const std::size_t SIZE {256U};
+
+    using ListType = Etl::Custom::List<std::size_t, Etl::PoolHelperForSize<SIZE, 8U>::CachedAllocator>;
+
+    std::atomic<std::size_t> errors {0U};
+
+    auto proc = [&errors](std::size_t id) {
+        for (std::size_t r = 0; r < 1000U; ++r) {
+            ListType list;
+            for (std::size_t i = 0; i < 16U; ++i) {
+                list.push_back(id);
+            }
+            if (list.size() != 16U) {
+                ++errors;
+            }
+            for (auto item : list) {
+                if (item != id) {
+                    ++errors;
+                }
+            }
+        }
+    };
+
+    Etl::Dynamic::List<std::thread> threads;
+    for (std::size_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back(proc, i);
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    REQUIRE(errors == 0U);
+    REQUIRE(ListType::Allocator().size() == 0U);
+    REQUIRE(ListType::Allocator().reserve() == SIZE);
+}
+
+
+TEST_CASE("Etl::GrowingPoolAllocator basic tests", "[poolallocator][etl]") {
+
+    Etl::GrowingPoolAllocator<int, 4> alloc;
+
+    REQUIRE(alloc.capacity() == 0U);
+    REQUIRE(alloc.size() == 0U);
+    REQUIRE(alloc.allocate(2U) == nullptr);
+
+    int* items[14] {};
+    for (auto& item : items) {
+        item = alloc.allocate(1U);
+        REQUIRE(item != nullptr);
+        *item = 1;
+    }
+
+    REQUIRE(alloc.size() == 14U);
+    REQUIRE(alloc.capacity() == 16U);
+    REQUIRE(alloc.getChunkCount() == 3U);
+    REQUIRE(items[1] > items[0]);
+
+    SECTION("free list reuse") {
+        alloc.deallocate(items[5], 1U);
+        REQUIRE(alloc.allocate(1U) == items[5]);
+        REQUIRE(alloc.capacity() == 16U);
+    }
+
+    SECTION("shrink() releases only free chunks") {
+
+        // The second chunk holds items 4..7.
+        for (std::size_t i = 4U; i < 8U; ++i) {
+            alloc.deallocate(items[i], 1U);
+        }
+
+        alloc.deallocate(items[0], 1U);
+
+        REQUIRE(alloc.shrink() == 4U);
+        REQUIRE(alloc.capacity() == 12U);
+        REQUIRE(alloc.getChunkCount() == 2U);
+        REQUIRE(alloc.size() == 9U);
+
+        REQUIRE(alloc.allocate(1U) == items[0]);
+        REQUIRE(alloc.capacity() == 12U);
+
+        for (std::size_t i = 4U; i < 8U; ++i) {
+            items[i] = nullptr;
+        }
+    }
+
+    for (auto item : items) {
+        alloc.deallocate(item, 1U);
+    }
+
+    alloc.shrink();
+}
+
+
+TEST_CASE("Etl::GrowingPoolAllocator shrink() all", "[poolallocator][etl]") {
+
+    Etl::GrowingPoolAllocator<int, 4> alloc;
+
+    int* items[10] {};
+    for (auto& item : items) {
+        item = alloc.allocate(1U);
+    }
+
+    for (auto item : items) {
+        alloc.deallocate(item, 1U);
+    }
+
+    REQUIRE(alloc.shrink() == 16U);
+    REQUIRE(alloc.capacity() == 0U);
+    REQUIRE(alloc.getChunkCount() == 0U);
+
+    int* item = alloc.allocate(1U);
+    REQUIRE(item != nullptr);
+    REQUIRE(alloc.capacity() == 4U);
+    alloc.deallocate(item, 1U);
+}
+
+
+TEST_CASE("Etl::GrowingPoolAllocator shrink() with many chunks", "[poolallocator][etl]") {
+
+    Etl::GrowingPoolAllocator<int, 4> alloc;
+
+    std::vector<int*> items;
+    for (int i = 0; i < 200; ++i) {
+        items.push_back(alloc.allocate(1U));
+        *items.back() = i;
+    }
+
+    REQUIRE(alloc.capacity() == 256U);
+    REQUIRE(alloc.getChunkCount() == 7U);
+
+    // Free the items of the third and fifth chunks and every third item elsewhere,
+    // in an order unrelated to the addresses.
+    std::vector<bool> freed(items.size(), false);
+    for (std::size_t i = 0U; i < items.size(); ++i) {
+        const std::size_t ix = (i * 37U) % items.size();
+        const bool inFreeChunk = ((ix >= 8U) && (ix < 16U)) || ((ix >= 32U) && (ix < 64U));
+        if (inFreeChunk || ((ix % 3U) == 0U)) {
+            alloc.deallocate(items[ix], 1U);
+            freed[ix] = true;
+        }
+    }
+
+    const std::size_t used = alloc.size();
+    REQUIRE(alloc.shrink() == 40U);
+    REQUIRE(alloc.capacity() == 216U);
+    REQUIRE(alloc.size() == used);
+
+    for (std::size_t i = 0U; i < items.size(); ++i) {
+        if (!freed[i]) {
+            REQUIRE(*items[i] == static_cast<int>(i));
+        }
+    }
+
+    std::vector<int*> again;
+    while (alloc.size() < alloc.capacity()) {
+        again.push_back(alloc.allocate(1U));
+    }
+
+    REQUIRE(alloc.capacity() == 216U);
+    std::sort(again.begin(), again.end());
+    REQUIRE(std::adjacent_find(again.begin(), again.end()) == again.end());
+
+    for (auto item : again) {
+        alloc.deallocate(item, 1U);
+    }
+
+    for (std::size_t i = 0U; i < items.size(); ++i) {
+        if (!freed[i]) {
+            alloc.deallocate(items[i], 1U);
+        }
+    }
+
+    REQUIRE(alloc.shrink() == 216U);
+}
+
+
+TEST_CASE("Etl::List<> with GrowingPoolAllocator", "[poolallocator][list][etl]") {
+
+    using ListType = Etl::Custom::List<int, Etl::GrowingPoolHelper<8U>::Allocator>;
+
+    ListType list;
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+
+    REQUIRE(list.size() == 100U);
+    REQUIRE(list.back() == 99);
+
+    list.remove_if([](int v) { return (v % 2) == 0; });
+    REQUIRE(list.size() == 50U);
+
+    ListType other {1, 2, 3};
+    list.swap(other);
+    REQUIRE(list.size() == 3U);
+    REQUIRE(other.size() == 50U);
+    REQUIRE(other.front() == 1);
+
+    list.clear();
+    other.clear();
+    REQUIRE(ListType::Allocator::shrink() > 0U);
+    REQUIRE(ListType::Allocator::capacity() == 0U);
+}
+
+
+TEST_CASE("Etl::PoolAllocator usage counters", "[poolallocator][etl]") {
+
+    Etl::PoolAllocator<int, 4> alloc;
+
+    int* items[4] {};
+    for (auto& item : items) {
+        item = alloc.allocate(1U);
+    }
+
+    REQUIRE(alloc.allocate(1U) == nullptr);
+    alloc.deallocate(items[0], 1U);
+    alloc.deallocate(items[1], 1U);
+    items[0] = alloc.allocate(1U);
+    REQUIRE(alloc.allocate(2U) == nullptr);
+
+    const Etl::PoolStats stats = alloc.getStats();
+
+#if ETL_POOL_STATS
+    REQUIRE(stats.highWater == 4U);
+    REQUIRE(stats.failures == 2U);
+    REQUIRE(stats.allocations == 5U);
+    REQUIRE(stats.frees == 2U);
+    REQUIRE(stats.contentions == 0U);
+#else
+    REQUIRE(stats.highWater == 0U);
+    REQUIRE(stats.failures == 0U);
+    REQUIRE(stats.allocations == 0U);
+    REQUIRE(stats.frees == 0U);
+#endif
+
+    alloc.deallocate(items[0], 1U);
+    alloc.deallocate(items[2], 1U);
+    alloc.deallocate(items[3], 1U);
+}
+
+
+TEST_CASE("Etl::AtomicMemoryPool<> usage counters", "[pool][etl]") {
+
+    Etl::AtomicMemoryPool<8, 2> pool;
+
+    void* a = pool.pop();
+    void* b = pool.pop();
+    REQUIRE(pool.pop() == nullptr);
+    REQUIRE(pool.push(a));
+    REQUIRE(pool.push(b));
+
+    const Etl::PoolStats stats = pool.getStats();
+
+#if ETL_POOL_STATS
+    REQUIRE(stats.highWater == 2U);
+    REQUIRE(stats.failures == 1U);
+    REQUIRE(stats.allocations == 2U);
+    REQUIRE(stats.frees == 2U);
+#else
+    REQUIRE(stats.allocations == 0U);
+#endif
+}
+
+
+TEST_CASE("Etl::PoolRegistry enumerates common pools", "[poolallocator][etl]") {
+
+    struct Item {
+        uint8_t data[24];
+    };
+
+    using Allocator = Etl::CommonPoolAllocator<Item, 1013U>;
+
+    Allocator alloc;
+    Item* item = alloc.allocate(1U);
+    REQUIRE(item != nullptr);
+
+    const Etl::PoolRegistry::Entry* found = nullptr;
+    std::size_t cnt = 0U;
+    Etl::PoolRegistry::forEach([&found, &cnt](const Etl::PoolRegistry::Entry& e) {
+        ++cnt;
+        if ((e.itemSize == sizeof(Item)) && (e.capacity == 1013U)) {
+            found = &e;
+        }
+    });
+
+    REQUIRE(cnt > 0U);
+    REQUIRE(found != nullptr);
+    REQUIRE(found->name != nullptr);
+    REQUIRE(found->size() == 1U);
+
+#if defined(__GNUC__)
+    REQUIRE(std::strstr(found->name, "CommonPoolAllocator") != nullptr);
+#endif
+
+    alloc.deallocate(item, 1U);
+    REQUIRE(found->size() == 0U);
+
+#if ETL_POOL_STATS
+    REQUIRE(found->stats().allocations == 1U);
+    REQUIRE(found->stats().frees == 1U);
+#endif
+}
+
 }  // namespace
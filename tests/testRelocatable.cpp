@@ -0,0 +1,351 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include <etl/RegionPool.h>
+#include <etl/RelocatableMap.h>
+#include <etl/RelocatableUnorderedMap.h>
+#include <etl/RelocatableVector.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace {
+
+// The regions are relocated with memcpy() to a new buffer,
+// the old buffer is overwritten to catch any absolute reference into it.
+struct Region {
+
+    static constexpr std::size_t SIZE {4096U};
+
+    alignas(std::max_align_t) std::uint8_t data[SIZE];
+
+    void relocateTo(Region& other) {
+        std::memcpy(other.data, data, SIZE);
+        std::memset(data, 0xA5, SIZE);
+    }
+};
+
+constexpr std::size_t Region::SIZE;
+
+
+TEST_CASE("Etl::Detail::OffsetPtr<> relocation", "[relocatable][etl]") {
+
+    struct Linked {
+        int value;
+        Etl::Detail::OffsetPtr<int> ptr;
+    };
+
+    Linked a {};
+    a.value = 5;
+    REQUIRE_FALSE(a.ptr);
+    REQUIRE(a.ptr.get() == nullptr);
+
+    a.ptr = &a.value;
+    REQUIRE(a.ptr);
+    REQUIRE(*a.ptr == 5);
+
+    Linked b {};
+    // Byte-wise copy, like mapping the same memory at another address
+    std::memcpy(static_cast<void*>(&b), &a, sizeof(Linked));
+    b.value = 6;
+    REQUIRE(b.ptr.get() == &b.value);
+    REQUIRE(*a.ptr == 5);
+
+    Etl::Detail::OffsetPtr<int> copy {a.ptr};
+    REQUIRE(copy.get() == &a.value);
+
+    a.ptr = nullptr;
+    REQUIRE_FALSE(a.ptr);
+}
+
+
+TEST_CASE("Etl::RegionPool basic test", "[relocatable][pool][etl]") {
+
+    Region r1;
+    Region r2;
+
+    REQUIRE(Etl::RegionPool::create(r1.data, 16U, 8U) == nullptr);
+    REQUIRE(Etl::RegionPool::create(r1.data + 1U, Region::SIZE - 1U, 8U) == nullptr);
+
+    auto* pool = Etl::RegionPool::create(r1.data, Region::SIZE, 20U, 16U);
+    REQUIRE(pool != nullptr);
+    REQUIRE(pool->getItemSize() == 32U);
+    REQUIRE(pool->capacity() > 100U);
+    REQUIRE(pool->capacity() < 128U);
+
+    void* i0 = pool->pop();
+    void* i1 = pool->pop();
+    void* i2 = pool->pop();
+    REQUIRE(i0 != nullptr);
+    REQUIRE((reinterpret_cast<std::uintptr_t>(i0) % 16U) == 0U);
+    REQUIRE(pool->push(i1));
+    REQUIRE(pool->getCount() == 2U);
+
+    const auto offsetOf = [](const void* ptr, const Region& r) {
+        return static_cast<std::size_t>(static_cast<const std::uint8_t*>(ptr) - r.data);
+    };
+    const std::size_t off1 = offsetOf(i1, r1);
+    const std::size_t off2 = offsetOf(i2, r1);
+
+    r1.relocateTo(r2);
+    REQUIRE(Etl::RegionPool::attach(r1.data) == nullptr);
+
+    pool = Etl::RegionPool::attach(r2.data);
+    REQUIRE(pool != nullptr);
+    REQUIRE(pool->getCount() == 2U);
+
+    void* j1 = pool->pop();
+    REQUIRE(offsetOf(j1, r2) == off1);
+    void* j3 = pool->pop();
+    REQUIRE(offsetOf(j3, r2) == (off2 + 32U));
+
+    REQUIRE_FALSE(pool->push(i0));
+    REQUIRE(pool->push(r2.data + off2));
+    REQUIRE(pool->getCount() == 3U);
+}
+
+
+TEST_CASE("Etl::Relocatable::Vector<> test", "[relocatable][vector][etl]") {
+
+    using VecT = Etl::Relocatable::Vector<std::uint32_t>;
+
+    Region r1;
+    Region r2;
+
+    VecT* vec = VecT::create(r1.data, VecT::requiredSize(16U));
+    REQUIRE(vec != nullptr);
+    REQUIRE(vec->empty());
+    REQUIRE(vec->capacity() >= 16U);
+
+    for (std::uint32_t i = 0U; i < 10U; ++i) {
+        REQUIRE(vec->push_back(i * 3U));
+    }
+
+    r1.relocateTo(r2);
+
+    const VecT* readOnly = VecT::attach(static_cast<const void*>(r2.data));
+    REQUIRE(readOnly != nullptr);
+    REQUIRE(readOnly->size() == 10U);
+    REQUIRE(readOnly->data() > static_cast<const void*>(r2.data));
+    REQUIRE(readOnly->data() < static_cast<const void*>(r2.data + Region::SIZE));
+
+    std::uint32_t expected = 0U;
+    for (auto v : *readOnly) {
+        REQUIRE(v == expected);
+        expected += 3U;
+    }
+
+    REQUIRE(Etl::Relocatable::Vector<std::uint64_t>::attach(r2.data) == nullptr);
+
+    SECTION("full") {
+        vec = VecT::attach(r2.data);
+        while (vec->size() < vec->capacity()) {
+            REQUIRE(vec->push_back(1U));
+        }
+        REQUIRE_FALSE(vec->push_back(2U));
+        REQUIRE(vec->size() == vec->capacity());
+        REQUIRE(vec->data()[vec->size() - 1U] == 1U);
+    }
+}
+
+
+TEST_CASE("Etl::Relocatable::UnorderedMap<> test", "[relocatable][unorderedmap][etl]") {
+
+    using MapT = Etl::Relocatable::UnorderedMap<std::uint32_t, std::uint32_t>;
+
+    Region r1;
+    Region r2;
+
+    REQUIRE(MapT::create(r1.data, Region::SIZE, 0U) == nullptr);
+
+    MapT* map = MapT::create(r1.data, Region::SIZE, 7U);
+    REQUIRE(map != nullptr);
+    REQUIRE(map->empty());
+    REQUIRE(map->bucket_count() == 7U);
+    REQUIRE(map->max_size() >= 100U);
+    REQUIRE(map->begin() == map->end());
+
+    for (std::uint32_t i = 0U; i < 100U; ++i) {
+        auto res = map->insert(i, i * 10U);
+        REQUIRE(res.second);
+        REQUIRE(res.first->first == i);
+    }
+
+    REQUIRE(map->size() == 100U);
+    REQUIRE_FALSE(map->insert(5U, 0U).second);
+    REQUIRE(map->erase(5U) == 1U);
+    REQUIRE(map->erase(5U) == 0U);
+    REQUIRE(map->erase(50U) == 1U);
+    REQUIRE(map->insert_or_assign(7U, 77U).second == false);
+
+    r1.relocateTo(r2);
+
+    const MapT* readOnly = MapT::attach(static_cast<const void*>(r2.data));
+    REQUIRE(readOnly != nullptr);
+    REQUIRE(readOnly->size() == 98U);
+
+    for (std::uint32_t i = 0U; i < 100U; ++i) {
+        auto it = readOnly->find(i);
+        if ((i == 5U) || (i == 50U)) {
+            REQUIRE(it == readOnly->end());
+            REQUIRE(readOnly->getItem(i) == nullptr);
+        } else {
+            REQUIRE(it != readOnly->end());
+            REQUIRE(it->second == ((i == 7U) ? 77U : (i * 10U)));
+        }
+    }
+
+    std::vector<bool> seen(100U, false);
+    std::size_t cnt = 0U;
+    for (const auto& item : *readOnly) {
+        REQUIRE(item.first < 100U);
+        REQUIRE_FALSE(seen[item.first]);
+        seen[item.first] = true;
+        ++cnt;
+    }
+
+    REQUIRE(cnt == readOnly->size());
+
+    using OtherMapT = Etl::Relocatable::UnorderedMap<std::uint32_t, std::uint64_t>;
+    REQUIRE(OtherMapT::attach(r2.data) == nullptr);
+
+    SECTION("modify after relocation") {
+
+        map = MapT::attach(r2.data);
+        REQUIRE(map->insert(5U, 55U).second);
+        REQUIRE(*map->getItem(5U) == 55U);
+
+        while (map->size() < map->max_size()) {
+            REQUIRE(map->insert(static_cast<std::uint32_t>(1000U + map->size()), 0U).second);
+        }
+
+        auto res = map->insert(100000U, 0U);
+        REQUIRE_FALSE(res.second);
+        REQUIRE(res.first == map->end());
+
+        map->clear();
+        REQUIRE(map->empty());
+        REQUIRE(map->begin() == map->end());
+        REQUIRE(map->insert(1U, 1U).second);
+        REQUIRE(map->size() == 1U);
+    }
+}
+
+
+TEST_CASE("Etl::Relocatable::Map<> test", "[relocatable][map][etl]") {
+
+    using MapT = Etl::Relocatable::Map<std::uint32_t, std::uint32_t>;
+
+    Region r1;
+    Region r2;
+
+    REQUIRE(MapT::create(r1.data, sizeof(MapT)) == nullptr);
+
+    MapT* map = MapT::create(r1.data, MapT::requiredSize(64U));
+    REQUIRE(map != nullptr);
+    REQUIRE(map->empty());
+    REQUIRE(map->max_size() >= 64U);
+
+    // Inserted in scrambled order
+    for (std::uint32_t i = 0U; i < 50U; ++i) {
+        const std::uint32_t key = (i * 17U) % 50U;
+        auto res = map->insert(key, key * 10U);
+        REQUIRE(res.second);
+        REQUIRE(res.first->first == key);
+    }
+
+    REQUIRE(map->size() == 50U);
+    REQUIRE_FALSE(map->insert(5U, 0U).second);
+    REQUIRE(map->erase(5U) == 1U);
+    REQUIRE(map->erase(5U) == 0U);
+    REQUIRE(map->erase(0U) == 1U);
+    REQUIRE(map->insert_or_assign(7U, 77U).second == false);
+
+    r1.relocateTo(r2);
+
+    const MapT* readOnly = MapT::attach(static_cast<const void*>(r2.data));
+    REQUIRE(readOnly != nullptr);
+    REQUIRE(readOnly->size() == 48U);
+    REQUIRE(std::is_sorted(readOnly->begin(),
+                           readOnly->end(),
+                           [](const MapT::value_type& a, const MapT::value_type& b) {
+                               return a.first < b.first;
+                           }));
+
+    for (std::uint32_t i = 0U; i < 50U; ++i) {
+        if ((i == 0U) || (i == 5U)) {
+            REQUIRE(readOnly->find(i) == readOnly->end());
+            REQUIRE(readOnly->getItem(i) == nullptr);
+        } else {
+            REQUIRE(readOnly->count(i) == 1U);
+            REQUIRE(*readOnly->getItem(i) == ((i == 7U) ? 77U : (i * 10U)));
+        }
+    }
+
+    REQUIRE(readOnly->lower_bound(5U)->first == 6U);
+    REQUIRE(readOnly->lower_bound(100U) == readOnly->end());
+
+    REQUIRE(Etl::Relocatable::Map<std::uint32_t, std::uint64_t>::attach(r2.data) == nullptr);
+    REQUIRE(Etl::Relocatable::Vector<std::uint32_t>::attach(r2.data) == nullptr);
+
+    SECTION("modify after relocation") {
+
+        map = MapT::attach(r2.data);
+        REQUIRE(map->insert(0U, 1U).second);
+        REQUIRE(map->begin()->first == 0U);
+
+        while (map->size() < map->max_size()) {
+            REQUIRE(map->insert(static_cast<std::uint32_t>(1000U + map->size()), 0U).second);
+        }
+
+        auto res = map->insert(500U, 0U);
+        REQUIRE_FALSE(res.second);
+        REQUIRE(res.first == map->end());
+
+        map->clear();
+        REQUIRE(map->empty());
+        REQUIRE(map->insert(1U, 1U).second);
+        REQUIRE(map->size() == 1U);
+    }
+
+    SECTION("custom compare") {
+
+        using DescT =
+            Etl::Relocatable::Map<std::uint32_t, std::uint32_t, std::greater<std::uint32_t>>;
+
+        DescT* desc = DescT::create(r1.data, Region::SIZE);
+        REQUIRE(desc != nullptr);
+        for (std::uint32_t i = 0U; i < 10U; ++i) {
+            REQUIRE(desc->insert(i, i).second);
+        }
+
+        REQUIRE(desc->begin()->first == 9U);
+        REQUIRE(desc->find(3U)->second == 3U);
+    }
+}
+
+}  // namespace
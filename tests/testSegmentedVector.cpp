@@ -0,0 +1,228 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#include <catch2/catch.hpp>
+
+#include <etl/SegmentedVector.h>
+
+#include "ContainerTester.h"
+#include "comparisionTests.h"
+#include "constructorTests.h"
+#include "sequenceTests.h"
+
+#include <algorithm>
+#include <vector>
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+static constexpr std::size_t CHUNK {4U};
+
+
+TEMPLATE_TEST_CASE("Etl::SegmentedVector<> constructor test",
+                   "[segvec][etl]",
+                   (Etl::Dynamic::SegmentedVector<ContainerTester, CHUNK>),
+                   (Etl::Static::SegmentedVector<ContainerTester, 16U, CHUNK>),
+                   (Etl::Pooled::SegmentedVector<ContainerTester, 16U, CHUNK>)) {
+
+    SECTION("V(size_t)") {
+        Etl::Test::constructForSize<TestType>();
+    }
+
+    SECTION("V(size_t, const value_type&)") {
+        Etl::Test::constructForSizeAndValue<TestType>(ContainerTester {17});
+    }
+
+    SECTION("V(InputIt, IntputIt)") {
+        Etl::Test::constructWithIterators<TestType>();
+    }
+
+    SECTION("V(std::initializer_list)") {
+        Etl::Test::constructWithInitList<TestType>();
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::SegmentedVector<> push/pop test",
+                   "[segvec][etl]",
+                   (Etl::Dynamic::SegmentedVector<int, CHUNK>),
+                   (Etl::Static::SegmentedVector<int, 16U, CHUNK>),
+                   (Etl::Pooled::SegmentedVector<int, 16U, CHUNK>)) {
+
+    Etl::Test::testBackAccess<TestType>();
+}
+
+
+TEMPLATE_TEST_CASE("Etl::SegmentedVector<> iteration test",
+                   "[segvec][etl]",
+                   (Etl::Dynamic::SegmentedVector<int, CHUNK>),
+                   (Etl::Static::SegmentedVector<int, 16U, CHUNK>),
+                   (Etl::Pooled::SegmentedVector<int, 16U, CHUNK>)) {
+
+    Etl::Test::testIterationForward<TestType>();
+    Etl::Test::testIterationBackward<TestType>();
+    Etl::Test::testReverseIterationForward<TestType>();
+    Etl::Test::testReverseIterationBackward<TestType>();
+
+    TestType c {5, 3, 9, 1, 7, 2};
+
+    std::sort(c.begin(), c.end());
+    REQUIRE(std::is_sorted(c.cbegin(), c.cend()));
+    REQUIRE((c.end() - c.begin()) == 6);
+    REQUIRE(c.begin()[4] == 7);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::SegmentedVector<> element stability",
+                   "[segvec][etl]",
+                   (Etl::Dynamic::SegmentedVector<ContainerTester, CHUNK>),
+                   (Etl::Static::SegmentedVector<ContainerTester, 16U, CHUNK>),
+                   (Etl::Pooled::SegmentedVector<ContainerTester, 16U, CHUNK>)) {
+
+    TestType c;
+    std::vector<const ContainerTester*> addresses;
+
+    const auto moveCnt = ContainerTester::getMoveCount();
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    for (int i = 0; i < 16; ++i) {
+        c.emplace_back(i);
+        addresses.push_back(&c.back());
+    }
+
+    REQUIRE(c.size() == 16U);
+    REQUIRE(c.capacity() == 16U);
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    for (int i = 0; i < 16; ++i) {
+        REQUIRE(&c[i] == addresses[i]);
+        REQUIRE(c[i] == ContainerTester(i));
+    }
+
+    SECTION("pop_back() and shrink_to_fit()") {
+
+        for (int i = 0; i < 7; ++i) {
+            c.pop_back();
+        }
+
+        REQUIRE(c.size() == 9U);
+        REQUIRE(c.capacity() == 16U);
+
+        c.shrink_to_fit();
+
+        REQUIRE(c.capacity() == 12U);
+        REQUIRE(&c.back() == addresses[8]);
+    }
+
+    SECTION("clear()") {
+
+        c.clear();
+
+        REQUIRE(c.empty());
+        REQUIRE(ContainerTester::getObjectCount() == 0U);
+    }
+}
+
+
+TEST_CASE("Etl::Static::SegmentedVector<> capacity test", "[segvec][static][etl]") {
+
+    Etl::Static::SegmentedVector<int, 10U, CHUNK> c;
+
+    REQUIRE(c.max_size() == 12U);
+
+    for (int i = 0; i < 20; ++i) {
+        c.push_back(i);
+    }
+
+    REQUIRE(c.size() == 12U);
+    REQUIRE(c.back() == 11);
+
+    c.reserve(20U);
+    REQUIRE(c.capacity() == 12U);
+}
+
+
+TEST_CASE("Etl::SegmentedVector<> assignment and swap", "[segvec][etl]") {
+
+    using DynType = Etl::Dynamic::SegmentedVector<ContainerTester, CHUNK>;
+    using StaticType = Etl::Static::SegmentedVector<ContainerTester, 16U, CHUNK>;
+
+    DynType dyn {ContainerTester(1), ContainerTester(2), ContainerTester(3)};
+    StaticType stat {ContainerTester(4), ContainerTester(5)};
+
+    SECTION("copy to base") {
+
+        Etl::SegmentedVector<ContainerTester, CHUNK>& base = stat;
+        base = dyn;
+
+        REQUIRE(stat == dyn);
+    }
+
+    SECTION("swap with same allocator") {
+
+        DynType other {ContainerTester(7)};
+        const auto* addr = &other.front();
+
+        dyn.swap(other);
+
+        REQUIRE(dyn.size() == 1U);
+        REQUIRE(other.size() == 3U);
+        REQUIRE(&dyn.front() == addr);
+    }
+
+    SECTION("swap with different allocator") {
+
+        swap(static_cast<Etl::SegmentedVector<ContainerTester, CHUNK>&>(dyn),
+             static_cast<Etl::SegmentedVector<ContainerTester, CHUNK>&>(stat));
+
+        REQUIRE(dyn.size() == 2U);
+        REQUIRE(stat.size() == 3U);
+        REQUIRE(dyn.back() == ContainerTester(5));
+        REQUIRE(stat.back() == ContainerTester(3));
+    }
+
+    SECTION("move") {
+
+        StaticType moved(std::move(stat));
+
+        REQUIRE(moved.size() == 2U);
+        REQUIRE(stat.empty());
+    }
+}
+
+
+TEST_CASE("Etl::SegmentedVector<> comparision", "[segvec][etl]") {
+
+    Etl::Dynamic::SegmentedVector<int, CHUNK> lhs {1, 2, 3, 4, 5};
+    Etl::Static::SegmentedVector<int, 16U, CHUNK> rhs {1, 2, 3, 4, 6};
+
+    REQUIRE(lhs != rhs);
+    REQUIRE(lhs < rhs);
+
+    rhs.back() = 5;
+    REQUIRE(lhs == rhs);
+}
+
+}  // namespace
@@ -183,6 +183,27 @@ TEST_CASE("Etl::Dynamic::Set<> emplace() test", "[set][etl]") {
 }
 
 
+TEST_CASE("Etl::Set<> insert with move", "[set][etl]") {
+
+    Etl::Dynamic::Set<ContainerTester> set;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    set.insert(ContainerTester(2));
+    set.insert(ContainerTester(1));
+    set.emplace(3);
+
+    ContainerTester item(4);
+    set.insert(std::move(item));
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(set.size() == 4);
+    REQUIRE(*set.begin() == ContainerTester(1));
+    REQUIRE(*(--set.end()) == ContainerTester(4));
+}
+
+
 TEST_CASE("Etl::Dynamic::Set<> erase tests", "[set][etl]") {
 
     typedef Etl::Dynamic::Set<int> SetType;
@@ -215,6 +236,17 @@ TEST_CASE("Etl::Dynamic::Set<> erase tests", "[set][etl]") {
         REQUIRE(set.find(2) == set.end());
         REQUIRE(it == set.find(3));
     }
+
+    SECTION("erase_if()") {
+
+        auto cnt = Etl::erase_if(set, [](int item) { return (item % 2) == 0; });
+
+        REQUIRE(cnt == 2);
+        REQUIRE(set.size() == 2);
+        REQUIRE(set.find(2) == set.end());
+        REQUIRE(set.find(4) == set.end());
+        REQUIRE(set.find(3) != set.end());
+    }
 }
 
 
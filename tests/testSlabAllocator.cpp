@@ -0,0 +1,247 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include <etl/List.h>
+#include <etl/SlabAllocator.h>
+#include <etl/UnorderedMap.h>
+#include <etl/Vector.h>
+
+#include "ContainerTester.h"
+
+#include <cstdint>
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+TEST_CASE("Etl::Detail::SlabBase size classes", "[slab][etl]") {
+
+    alignas(Etl::Detail::SlabBase::MAX_ALIGN) uint8_t region[1024U + 256U];
+    Etl::Detail::SlabBase slab {region, sizeof(region), 128U};
+
+    REQUIRE(slab.capacity() == 1024U);
+    REQUIRE(slab.getFreePageCount() == 8U);
+    REQUIRE(slab.available(16U) == 64U);
+
+    void* a = slab.allocate(10U, 8U);
+    void* b = slab.allocate(16U, 8U);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(slab.getFreePageCount() == 7U);
+    REQUIRE(slab.getUsed() == 32U);
+    REQUIRE(slab.available(16U) == 6U + (7U * 8U));
+
+    void* c = slab.allocate(40U, 8U);
+    REQUIRE(c != nullptr);
+    REQUIRE(((static_cast<uint8_t*>(c) - static_cast<uint8_t*>(a)) % 64) == 0);
+    REQUIRE(slab.getFreePageCount() == 6U);
+
+    slab.deallocate(a, 10U);
+    REQUIRE(slab.allocate(12U, 4U) == a);
+
+    slab.deallocate(a, 12U);
+    slab.deallocate(b, 16U);
+    slab.deallocate(c, 40U);
+    REQUIRE(slab.getUsed() == 0U);
+
+    REQUIRE(slab.allocate(8U, 2U * Etl::Detail::SlabBase::MAX_ALIGN) == nullptr);
+    REQUIRE(slab.allocate(0U, 1U) == nullptr);
+}
+
+
+TEST_CASE("Etl::Detail::SlabBase page runs", "[slab][etl]") {
+
+    alignas(Etl::Detail::SlabBase::MAX_ALIGN) uint8_t region[512U + 128U];
+    Etl::Detail::SlabBase slab {region, sizeof(region), 128U};
+
+    REQUIRE(slab.getFreePageCount() == 4U);
+    REQUIRE(slab.available(200U) == 2U);
+
+    void* a = slab.allocate(200U, 8U);
+    void* b = slab.allocate(100U, 8U);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(slab.getFreePageCount() == 1U);
+    REQUIRE(slab.allocate(200U, 8U) == nullptr);
+
+    slab.deallocate(a, 200U);
+    REQUIRE(slab.getFreePageCount() == 3U);
+
+    REQUIRE(slab.allocate(300U, 8U) == nullptr);
+
+    void* c = slab.allocate(256U, 8U);
+    REQUIRE(c == a);
+
+    slab.deallocate(b, 100U);
+    slab.deallocate(c, 256U);
+    REQUIRE(slab.getFreePageCount() == 4U);
+    REQUIRE(slab.getUsed() == 0U);
+}
+
+
+TEST_CASE("Etl::Detail::SlabBase returns empty class pages", "[slab][etl]") {
+
+    alignas(Etl::Detail::SlabBase::MAX_ALIGN) uint8_t region[512U + 128U];
+    Etl::Detail::SlabBase slab {region, sizeof(region), 128U};
+
+    // Fill two pages of the 16 byte class.
+    void* items[16];
+    for (auto& item : items) {
+        item = slab.allocate(16U, 8U);
+        REQUIRE(item != nullptr);
+    }
+
+    REQUIRE(slab.getFreePageCount() == 2U);
+    REQUIRE(slab.allocate(256U, 8U) != nullptr);
+    REQUIRE(slab.getFreePageCount() == 0U);
+
+    // The first emptied page is kept as the only class page with free blocks.
+    for (std::size_t i = 0U; i < 8U; ++i) {
+        slab.deallocate(items[i], 16U);
+    }
+
+    REQUIRE(slab.getFreePageCount() == 0U);
+    REQUIRE(slab.available(16U) == 8U);
+
+    // The second one is returned to the free pages.
+    for (std::size_t i = 8U; i < 16U; ++i) {
+        slab.deallocate(items[i], 16U);
+    }
+
+    REQUIRE(slab.getFreePageCount() == 1U);
+    REQUIRE(slab.available(16U) == 16U);
+    REQUIRE(slab.getUsed() == 256U);
+}
+
+
+TEST_CASE("Etl::Detail::SlabBase configured classes", "[slab][etl]") {
+
+    static const std::size_t SIZES[] = {16U, 48U, 96U};
+
+    alignas(Etl::Detail::SlabBase::MAX_ALIGN) uint8_t region[1024U + 256U];
+    Etl::Detail::SlabBase slab {region, sizeof(region), 256U, SIZES, 3U};
+
+    REQUIRE(slab.getClassCount() == 3U);
+    REQUIRE(slab.getClassSize(1U) == 48U);
+    REQUIRE(slab.available(40U) == (4U * 5U));
+
+    void* a = slab.allocate(40U, 8U);
+    void* b = slab.allocate(40U, 8U);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE((static_cast<uint8_t*>(b) - static_cast<uint8_t*>(a)) == 48);
+    REQUIRE(slab.getUsed() == 96U);
+
+    void* c = slab.allocate(100U, 8U);
+    REQUIRE(c != nullptr);
+    REQUIRE(slab.getUsed() == (96U + 256U));
+
+    slab.deallocate(a, 40U);
+    slab.deallocate(b, 40U);
+    slab.deallocate(c, 100U);
+    REQUIRE(slab.getUsed() == 0U);
+}
+
+
+using Region = Etl::StaticSlab<32768U, 256U>;
+
+
+TEST_CASE("Etl::SlabAllocator basic tests", "[slab][etl]") {
+
+    Region::Allocator<int> intAlloc;
+    Region::Allocator<ContainerTester> ctAlloc;
+
+    REQUIRE(intAlloc.handle() == ctAlloc.handle());
+    REQUIRE(intAlloc.max_size() == (Region::slab().capacity() / sizeof(int)));
+
+    int* ints = intAlloc.allocate(40U);
+    ContainerTester* ct = ctAlloc.allocate(1U);
+    REQUIRE(ints != nullptr);
+    REQUIRE(ct != nullptr);
+    REQUIRE(intAlloc.size() == 40U);
+    REQUIRE(ctAlloc.size() == 1U);
+
+    REQUIRE(intAlloc.allocate(100000U) == nullptr);
+
+    intAlloc.deallocate(ints, 40U);
+    ctAlloc.deallocate(ct, 1U);
+    REQUIRE(intAlloc.size() == 0U);
+    REQUIRE(ctAlloc.size() == 0U);
+    REQUIRE(Region::slab().getUsed() == 0U);
+}
+
+
+TEST_CASE("Etl::SlabAllocator with containers", "[slab][etl]") {
+
+    {
+        Etl::Custom::Vector<int, Region::Allocator> vec;
+        Etl::Custom::List<ContainerTester, Region::Allocator> list;
+        Etl::Custom::UnorderedMap<int, int, Region::Allocator> map;
+
+        for (int i = 0; i < 100; ++i) {
+            vec.push_back(i);
+            list.emplace_back(i);
+            map.insert(i, 2 * i);
+        }
+
+        REQUIRE(vec.size() == 100U);
+        REQUIRE(list.size() == 100U);
+        REQUIRE(map.size() == 100U);
+        REQUIRE(vec[99] == 99);
+        REQUIRE(list.back() == ContainerTester(99));
+        REQUIRE(map[50] == 100);
+        REQUIRE(Region::slab().getUsed() > 0U);
+
+        Etl::Custom::List<ContainerTester, Region::Allocator> other {ContainerTester(-1)};
+        list.swap(other);
+        REQUIRE(list.size() == 1U);
+        REQUIRE(other.size() == 100U);
+    }
+
+    REQUIRE(Region::slab().getUsed() == 0U);
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEST_CASE("Etl::DynamicSlab", "[slab][etl]") {
+
+    using Heap = Etl::DynamicSlab<4096U, 128U>;
+
+    {
+        Etl::Custom::Vector<int, Heap::Allocator> vec;
+        for (int i = 0; i < 200; ++i) {
+            vec.push_back(i);
+        }
+
+        REQUIRE(vec.size() == 200U);
+        REQUIRE(vec.back() == 199);
+        REQUIRE(Heap::slab().getUsed() >= (200U * sizeof(int)));
+    }
+
+    REQUIRE(Heap::slab().capacity() <= 4096U);
+    REQUIRE(Heap::slab().getUsed() == 0U);
+}
+
+}  // namespace
@@ -0,0 +1,240 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+#include <catch2/catch.hpp>
+
+#include <etl/Algorithms.h>
+#include <etl/SoAVector.h>
+
+#include "ContainerTester.h"
+
+#include <numeric>
+#include <tuple>
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+TEMPLATE_TEST_CASE("Etl::SoAVector<> push/pop test",
+                   "[soavec][etl]",
+                   (Etl::Dynamic::SoAVector<int, ContainerTester, double>),
+                   (Etl::Static::SoAVector<16U, int, ContainerTester, double>)) {
+
+    TestType soa;
+    REQUIRE(soa.empty());
+    REQUIRE(soa.size() == 0U);
+
+    soa.push_back(1, ContainerTester(2), 3.0);
+    const ContainerTester ct(5);
+    soa.push_back(4, ct, 6.0);
+
+    REQUIRE(soa.size() == 2U);
+    REQUIRE(soa.capacity() >= 2U);
+    REQUIRE(std::get<0>(soa.front()) == 1);
+    REQUIRE(std::get<1>(soa.front()) == ContainerTester(2));
+    REQUIRE(std::get<2>(soa.back()) == 6.0);
+    REQUIRE(soa.template get<1>(1U) == ContainerTester(5));
+
+    std::get<0>(soa[1]) = 40;
+    REQUIRE(soa.template get<0>(1U) == 40);
+
+    soa.pop_back();
+    REQUIRE(soa.size() == 1U);
+    REQUIRE(soa.template column<0>().size() == 1U);
+    REQUIRE(soa.template column<1>().size() == 1U);
+    REQUIRE(soa.template column<2>().size() == 1U);
+
+    soa.clear();
+    REQUIRE(soa.empty());
+}
+
+
+TEMPLATE_TEST_CASE("Etl::SoAVector<> column access",
+                   "[soavec][etl]",
+                   (Etl::Dynamic::SoAVector<int, float>),
+                   (Etl::Static::SoAVector<64U, int, float>)) {
+
+    TestType soa;
+    for (int i = 0; i < 50; ++i) {
+        soa.push_back(i, static_cast<float>(i) * 0.5F);
+    }
+
+    auto ids = soa.template column<0>();
+    REQUIRE(ids.size() == 50U);
+    REQUIRE(std::accumulate(ids.begin(), ids.end(), 0) == (49 * 50) / 2);
+    REQUIRE(Etl::find(ids, 33) == ids.begin() + 33);
+
+    const TestType& cSoa = soa;
+    auto values = cSoa.template column<1>();
+    REQUIRE(values.size() == 50U);
+    REQUIRE(values[10] == 5.0F);
+
+    for (auto& v : soa.template column<1>()) {
+        v = 1.0F;
+    }
+
+    REQUIRE(std::get<1>(soa[49]) == 1.0F);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::SoAVector<> iteration and erase",
+                   "[soavec][etl]",
+                   (Etl::Dynamic::SoAVector<int, ContainerTester>),
+                   (Etl::Static::SoAVector<16U, int, ContainerTester>)) {
+
+    TestType soa;
+    for (int i = 0; i < 8; ++i) {
+        soa.push_back(i, ContainerTester(i * 10));
+    }
+
+    int cnt = 0;
+    for (auto row : soa) {
+        REQUIRE(std::get<0>(row) == cnt);
+        REQUIRE(std::get<1>(row) == ContainerTester(cnt * 10));
+        std::get<0>(row) += 100;
+        ++cnt;
+    }
+
+    REQUIRE(cnt == 8);
+    REQUIRE((soa.end() - soa.begin()) == 8);
+    REQUIRE(std::get<0>(*(soa.cbegin() + 3)) == 103);
+
+    auto it = soa.erase(soa.cbegin() + 2);
+    REQUIRE(soa.size() == 7U);
+    REQUIRE(std::get<0>(*it) == 103);
+    REQUIRE(std::get<1>(*it) == ContainerTester(30));
+
+    it = soa.erase(soa.cbegin() + 4, soa.cend());
+    REQUIRE(soa.size() == 4U);
+    REQUIRE(it == soa.end());
+    REQUIRE(std::get<0>(soa.back()) == 104);
+    REQUIRE(std::get<1>(soa.back()) == ContainerTester(40));
+}
+
+
+TEST_CASE("Etl::Static::SoAVector<> capacity", "[soavec][static][etl]") {
+
+    Etl::Static::SoAVector<4U, int, ContainerTester> soa;
+    REQUIRE(soa.max_size() == 4U);
+
+    for (int i = 0; i < 6; ++i) {
+        soa.push_back(i, ContainerTester(i));
+    }
+
+    REQUIRE(soa.size() == 4U);
+    REQUIRE(soa.template column<0>().size() == 4U);
+    REQUIRE(soa.template column<1>().size() == 4U);
+    REQUIRE(std::get<0>(soa.back()) == 3);
+
+    soa.resize(8U);
+    REQUIRE(soa.size() == 4U);
+    REQUIRE(soa.template column<1>().size() == 4U);
+
+    Etl::Dynamic::SoAVector<int, ContainerTester> dyn;
+    for (int i = 0; i < 6; ++i) {
+        dyn.push_back(i, ContainerTester(i));
+    }
+
+    Etl::SoAVector<int, ContainerTester>& base = soa;
+    REQUIRE_FALSE(base.swap(dyn));
+    REQUIRE(soa.size() == 4U);
+    REQUIRE(soa.template column<1>().size() == 4U);
+    REQUIRE(dyn.size() == 6U);
+    REQUIRE(dyn.template column<0>().size() == 6U);
+
+    base = dyn;
+    REQUIRE(soa.size() == 4U);
+    REQUIRE(soa.template column<1>().size() == 4U);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::SoAVector<> assignment and swap",
+                   "[soavec][etl]",
+                   (Etl::Dynamic::SoAVector<int, ContainerTester>),
+                   (Etl::Static::SoAVector<16U, int, ContainerTester>)) {
+
+    TestType soa1;
+    soa1.push_back(1, ContainerTester(1));
+    soa1.push_back(2, ContainerTester(2));
+
+    TestType soa2(soa1);
+    REQUIRE(soa2 == soa1);
+
+    soa2.push_back(3, ContainerTester(3));
+    REQUIRE(soa2 != soa1);
+
+    soa1 = soa2;
+    REQUIRE(soa1 == soa2);
+    REQUIRE(soa1.size() == 3U);
+
+    TestType soa3;
+    soa3.push_back(7, ContainerTester(7));
+
+    swap(soa1, soa3);
+    REQUIRE(soa1.size() == 1U);
+    REQUIRE(soa3.size() == 3U);
+    REQUIRE(std::get<0>(soa1[0]) == 7);
+    REQUIRE(std::get<1>(soa3[2]) == ContainerTester(3));
+
+    TestType soa4(std::move(soa3));
+    REQUIRE(soa4.size() == 3U);
+    REQUIRE(soa3.empty());
+
+    Etl::Dynamic::SoAVector<int, ContainerTester> dyn(soa4);
+    REQUIRE(dyn.size() == 3U);
+    REQUIRE(std::get<1>(dyn[1]) == ContainerTester(2));
+}
+
+
+TEST_CASE("Etl::Dynamic::SoAVector<> swap exchanges the storage", "[soavec][dynamic][etl]") {
+
+    Etl::Dynamic::SoAVector<int, ContainerTester> soa1;
+    Etl::Dynamic::SoAVector<int, ContainerTester> soa2;
+
+    soa1.push_back(9, ContainerTester(9));
+
+    for (int i = 0; i < 40; ++i) {
+        soa2.push_back(i, ContainerTester(i));
+    }
+
+    const int* ints = soa2.template column<0>().data();
+    const ContainerTester* testers = soa2.template column<1>().data();
+    const auto capacity = soa1.capacity();
+    const auto moveCnt = ContainerTester::getMoveCount();
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    REQUIRE(soa1.swap(soa2));
+    REQUIRE(ContainerTester::getMoveCount() == moveCnt);
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+    REQUIRE(soa1.size() == 40U);
+    REQUIRE(soa2.size() == 1U);
+    REQUIRE(soa1.template column<0>().data() == ints);
+    REQUIRE(soa1.template column<1>().data() == testers);
+    REQUIRE(soa2.capacity() == capacity);
+}
+
+
+TEST_CASE("Etl::SoAVector<> test cleanup", "[soavec][etl]") {
+
+    CHECK(ContainerTester::getObjectCount() == 0);
+}
+
+}  // namespace
@@ -176,6 +176,29 @@ TEST_CASE("Etl::Dynamic::UnorderedMap<> insert test", "[unorderedmap][etl]") {
 }
 
 
+TEST_CASE("Etl::UnorderedMap<> insert with move", "[unorderedmap][etl]") {
+
+    using MapType = Etl::Dynamic::UnorderedMap<int, ContainerTester>;
+    MapType map;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    map.insert(MapType::value_type(1, ContainerTester(-1)));
+    map.insert_or_assign(2, ContainerTester(-2));
+    map.insert_or_assign(2, ContainerTester(-3));
+    map.emplace(3, ContainerTester(-4));
+    map[4] = ContainerTester(-5);
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(map.size() == 4);
+    REQUIRE(map[1] == ContainerTester(-1));
+    REQUIRE(map[2] == ContainerTester(-3));
+    REQUIRE(map[3] == ContainerTester(-4));
+    REQUIRE(map[4] == ContainerTester(-5));
+}
+
+
 TEST_CASE("Etl::Dynamic::UnorderedMap<> erase tests", "[unorderedmap][etl]") {
 
     typedef Etl::Dynamic::UnorderedMap<int, uint32_t> MapType;
@@ -208,6 +231,19 @@ TEST_CASE("Etl::Dynamic::UnorderedMap<> erase tests", "[unorderedmap][etl]") {
         REQUIRE(map.find(2) == map.end());
         REQUIRE(it == map.find(3));
     }
+
+    SECTION("erase_if()") {
+
+        auto cnt = Etl::erase_if(map, [](const MapType::value_type& item) {
+            return (item.first % 2) == 0;
+        });
+
+        REQUIRE(cnt == 2);
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.find(2) == map.end());
+        REQUIRE(map.find(4) == map.end());
+        REQUIRE(map.find(3) != map.end());
+    }
 }
 
 
@@ -1031,6 +1067,39 @@ TEST_CASE("Etl::Static::UnorderedMap<> test", "[unorderedmap][etl]") {
 }
 
 
+TEST_CASE("Etl::Static::UnorderedMap<> clear() resets the pool", "[unorderedmap][etl]") {
+
+    static const uint32_t NUM = 16;
+    typedef Etl::Static::UnorderedMap<uint32_t, int, NUM, 8U> MapType;
+
+    MapType map;
+
+    for (uint32_t round = 0; round < 3; ++round) {
+
+        for (uint32_t i = 0; i < NUM; ++i) {
+            map.insert(i + round, static_cast<int>(i));
+        }
+
+        REQUIRE(map.size() == NUM);
+        REQUIRE(map.insert(NUM + round, 0).second == false);
+
+        map.clear();
+
+        REQUIRE(map.empty());
+        REQUIRE(map.begin() == map.end());
+        REQUIRE(map.find(round) == map.end());
+        for (uint32_t b = 0; b < map.bucket_count(); ++b) {
+            REQUIRE(map.bucket_size(b) == 0U);
+        }
+    }
+
+    map.insert(3, 3);
+    REQUIRE(map.size() == 1U);
+    REQUIRE(map.find(3) != map.end());
+    REQUIRE(map.find(3)->second == 3);
+}
+
+
 TEST_CASE("Etl::UnorderedMap<> test cleanup", "[unorderedmap][etl]") {
 
     typedef Etl::Custom::UnorderedMap<uint32_t, ContainerTester, DummyAllocator> MapType;
@@ -194,6 +194,25 @@ TEST_CASE("Etl::Dynamic::UnorderedMultiMap<> insert test", "[unorderedmultimap][
 }
 
 
+TEST_CASE("Etl::UnorderedMultiMap<> insert with move", "[unorderedmultimap][etl]") {
+
+    using MapType = Etl::Dynamic::UnorderedMultiMap<int, ContainerTester>;
+    MapType map;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    map.insert(MapType::value_type(1, ContainerTester(-1)));
+    map.insert(MapType::value_type(1, ContainerTester(-2)));
+    map.emplace(2, ContainerTester(-3));
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.count(1) == 2);
+    REQUIRE(map.find(2)->second == ContainerTester(-3));
+}
+
+
 TEST_CASE("Etl::Dynamic::UnorderedMultiMap<> erase tests", "[unorderedmultimap][etl]") {
 
     typedef Etl::Dynamic::UnorderedMultiMap<int, uint32_t> MapType;
@@ -226,6 +245,19 @@ TEST_CASE("Etl::Dynamic::UnorderedMultiMap<> erase tests", "[unorderedmultimap][
         REQUIRE(map.find(2) == map.end());
         REQUIRE(it == map.find(3));
     }
+
+    SECTION("erase_if()") {
+
+        auto cnt = Etl::erase_if(map, [](const MapType::value_type& item) {
+            return (item.first % 2) == 0;
+        });
+
+        REQUIRE(cnt == 2);
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.find(2) == map.end());
+        REQUIRE(map.find(4) == map.end());
+        REQUIRE(map.find(3) != map.end());
+    }
 }
 
 
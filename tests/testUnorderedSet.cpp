@@ -203,6 +203,26 @@ TEST_CASE("Etl::Dynamic::UnorderedSet<> emplace() test", "[unorderedset][etl]")
 }
 
 
+TEST_CASE("Etl::UnorderedSet<> insert with move", "[unorderedset][etl]") {
+
+    Etl::Dynamic::UnorderedSet<ContainerTester> set;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    set.insert(ContainerTester(1));
+    set.emplace(2);
+
+    ContainerTester item(3);
+    set.insert(std::move(item));
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(set.size() == 3);
+    REQUIRE(set.find(ContainerTester(1)) != set.end());
+    REQUIRE(set.find(ContainerTester(3)) != set.end());
+}
+
+
 TEST_CASE("Etl::Dynamic::UnorderedSet<> erase tests", "[unorderedset][etl]") {
 
     using SetType = Etl::Dynamic::UnorderedSet<int>;
@@ -235,6 +255,17 @@ TEST_CASE("Etl::Dynamic::UnorderedSet<> erase tests", "[unorderedset][etl]") {
         REQUIRE(set.find(2) == set.end());
         REQUIRE(it == set.find(3));
     }
+
+    SECTION("erase_if()") {
+
+        auto cnt = Etl::erase_if(set, [](int item) { return (item % 2) == 0; });
+
+        REQUIRE(cnt == 2);
+        REQUIRE(set.size() == 2);
+        REQUIRE(set.find(2) == set.end());
+        REQUIRE(set.find(4) == set.end());
+        REQUIRE(set.find(3) != set.end());
+    }
 }
 
 
@@ -0,0 +1,341 @@
+/** \file
+\author Balazs Toth - baltth@gmail.com
+
+\copyright
+\parblock
+Copyright 2016-2024 Balazs Toth.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+\endparblock
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include <etl/UnrolledList.h>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "ContainerTester.h"
+#include "constructorTests.h"
+
+using Etl::Test::ContainerTester;
+
+namespace {
+
+static constexpr std::size_t NODE {4U};
+
+
+struct ThrowingMove {
+    ThrowingMove() = default;
+    ThrowingMove(const ThrowingMove& other) = default;
+    ThrowingMove(ThrowingMove&& /*other*/) noexcept(false) {}
+};
+
+using ThrowingList = Etl::UnrolledList<ThrowingMove, NODE>;
+using IntList = Etl::UnrolledList<int, NODE>;
+
+static_assert(noexcept(std::declval<ThrowingList&>().clear()), "clear() should be noexcept");
+static_assert(!noexcept(std::declval<ThrowingList&>().erase(ThrowingList::const_iterator {})),
+              "erase() may throw when relocating elements");
+static_assert(!noexcept(std::declval<ThrowingList&>().pop_front()),
+              "pop_front() may throw when relocating elements");
+static_assert(noexcept(std::declval<IntList&>().erase(IntList::const_iterator {})),
+              "erase() should be noexcept");
+
+
+template<class C>
+std::vector<int> valuesOf(const C& cont) {
+    std::vector<int> res;
+    for (const auto& item : cont) {
+        res.push_back(item.getValue());
+    }
+    return res;
+}
+
+
+TEMPLATE_TEST_CASE("Etl::UnrolledList<> constructor test",
+                   "[unrolledlist][etl]",
+                   (Etl::Dynamic::UnrolledList<ContainerTester, NODE>),
+                   (Etl::Static::UnrolledList<ContainerTester, 8U, NODE>),
+                   (Etl::Pooled::UnrolledList<ContainerTester, 8U, NODE>)) {
+
+    SECTION("UL(size_t)") {
+        Etl::Test::constructForSize<TestType>();
+    }
+
+    SECTION("UL(size_t, const value_type&)") {
+        Etl::Test::constructForSizeAndValue<TestType>(ContainerTester {17});
+    }
+
+    SECTION("UL(InputIt, IntputIt)") {
+        Etl::Test::constructWithIterators<TestType>();
+    }
+
+    SECTION("UL(std::initializer_list)") {
+        Etl::Test::constructWithInitList<TestType>();
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEMPLATE_TEST_CASE("Etl::UnrolledList<> insert and erase",
+                   "[unrolledlist][etl]",
+                   (Etl::Dynamic::UnrolledList<ContainerTester, NODE>),
+                   (Etl::Static::UnrolledList<ContainerTester, 16U, NODE>),
+                   (Etl::Pooled::UnrolledList<ContainerTester, 16U, NODE>)) {
+
+    {
+        TestType list;
+        std::vector<int> ref;
+
+        for (int i = 0; i < 10; ++i) {
+            list.push_back(ContainerTester(i));
+            ref.push_back(i);
+        }
+
+        REQUIRE(list.size() == 10U);
+        REQUIRE(list.front() == ContainerTester(0));
+        REQUIRE(list.back() == ContainerTester(9));
+        REQUIRE(valuesOf(list) == ref);
+
+        SECTION("insert() in the middle") {
+
+            auto it = list.begin();
+            std::advance(it, 5);
+            it = list.insert(it, ContainerTester(100));
+            ref.insert(ref.begin() + 5, 100);
+
+            REQUIRE(*it == ContainerTester(100));
+            REQUIRE(valuesOf(list) == ref);
+
+            it = list.insert(it, 3U, ContainerTester(50));
+            ref.insert(ref.begin() + 5, 3U, 50);
+
+            REQUIRE(*it == ContainerTester(50));
+            REQUIRE(list.size() == ref.size());
+            REQUIRE(valuesOf(list) == ref);
+
+            list.push_front(ContainerTester(-1));
+            ref.insert(ref.begin(), -1);
+            REQUIRE(valuesOf(list) == ref);
+        }
+
+        SECTION("erase()") {
+
+            auto it = list.begin();
+            std::advance(it, 3);
+            it = list.erase(it);
+            ref.erase(ref.begin() + 3);
+
+            REQUIRE(*it == ContainerTester(4));
+            REQUIRE(valuesOf(list) == ref);
+
+            auto last = it;
+            std::advance(last, 4);
+            it = list.erase(it, last);
+            ref.erase(ref.begin() + 3, ref.begin() + 7);
+
+            REQUIRE(*it == ContainerTester(8));
+            REQUIRE(valuesOf(list) == ref);
+
+            list.pop_front();
+            list.pop_back();
+            ref.erase(ref.begin());
+            ref.pop_back();
+
+            REQUIRE(valuesOf(list) == ref);
+        }
+
+        SECTION("remove_if()") {
+
+            auto cnt = list.remove_if([](const ContainerTester& item) {
+                return (item.getValue() % 3) != 0;
+            });
+
+            REQUIRE(cnt == 6U);
+            REQUIRE(valuesOf(list) == (std::vector<int> {0, 3, 6, 9}));
+        }
+
+        SECTION("reverse iteration") {
+
+            std::vector<int> values;
+            for (auto it = list.rbegin(); it != list.rend(); ++it) {
+                values.push_back(it->getValue());
+            }
+
+            std::reverse(ref.begin(), ref.end());
+            REQUIRE(values == ref);
+        }
+    }
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
+TEST_CASE("Etl::UnrolledList<> random operations", "[unrolledlist][etl]") {
+
+    Etl::Dynamic::UnrolledList<int, 8U> list;
+    std::vector<int> ref;
+
+    unsigned seed = 12345U;
+    auto next = [&seed]() {
+        seed = (seed * 1103515245U) + 12345U;
+        return (seed >> 16U) & 0x7FFFU;
+    };
+
+    for (int i = 0; i < 2000; ++i) {
+
+        const std::size_t ix = ref.empty() ? 0U : (next() % (ref.size() + 1U));
+        auto it = list.begin();
+        std::advance(it, ix);
+
+        if (((next() % 3U) != 0U) || ref.empty() || (ix == ref.size())) {
+            list.insert(it, i);
+            ref.insert(ref.begin() + ix, i);
+        } else {
+            list.erase(it);
+            ref.erase(ref.begin() + ix);
+        }
+    }
+
+    REQUIRE(list.size() == ref.size());
+    REQUIRE(std::equal(list.begin(), list.end(), ref.begin()));
+}
+
+
+TEST_CASE("Etl::UnrolledList<> with different allocators", "[unrolledlist][etl]") {
+
+    using Base = Etl::UnrolledList<ContainerTester, NODE>;
+
+    Etl::Dynamic::UnrolledList<ContainerTester, NODE> dyn;
+    Etl::Static::UnrolledList<ContainerTester, 8U, NODE> stat {ContainerTester(7),
+                                                               ContainerTester(8)};
+    for (int i = 0; i < 9; ++i) {
+        dyn.push_back(ContainerTester(i));
+    }
+
+    SECTION("swap()") {
+
+        swap(static_cast<Base&>(dyn), static_cast<Base&>(stat));
+
+        REQUIRE(valuesOf(dyn) == (std::vector<int> {7, 8}));
+        REQUIRE(valuesOf(stat) == (std::vector<int> {0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    }
+
+    SECTION("copy and compare") {
+
+        Base& base = stat;
+        base = dyn;
+
+        REQUIRE(stat == dyn);
+
+        stat.back() = ContainerTester(0);
+        REQUIRE(stat != dyn);
+    }
+
+    SECTION("swap with same allocator") {
+
+        Etl::Dynamic::UnrolledList<ContainerTester, NODE> other {ContainerTester(1)};
+        const ContainerTester* addr = &other.front();
+
+        dyn.swap(other);
+
+        REQUIRE(dyn.size() == 1U);
+        REQUIRE(other.size() == 9U);
+        REQUIRE(&dyn.front() == addr);
+    }
+}
+
+
+TEST_CASE("Etl::Static::UnrolledList<> capacity", "[unrolledlist][static][etl]") {
+
+    Etl::Static::UnrolledList<int, 2U, NODE> list;
+
+    REQUIRE(list.max_size() == 8U);
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+
+    REQUIRE(list.size() == 8U);
+    REQUIRE(list.back() == 7);
+
+    auto it = list.insert(list.begin(), -1);
+    REQUIRE(it == list.end());
+    REQUIRE(list.size() == 8U);
+}
+
+
+struct ThrowOnNegative {
+
+    int value;
+
+    explicit ThrowOnNegative(int v) :
+        value(v) {
+        if (v < 0) {
+            throw std::runtime_error("negative");
+        }
+    }
+};
+
+
+TEST_CASE("Etl::UnrolledList<> emplace() keeps the list on throw", "[unrolledlist][etl]") {
+
+    using ListT = Etl::Dynamic::UnrolledList<ThrowOnNegative, NODE>;
+
+    auto valuesOfList = [](const ListT& l) {
+        std::vector<int> res;
+        for (const auto& item : l) {
+            res.push_back(item.value);
+        }
+        return res;
+    };
+
+    ListT list;
+
+    REQUIRE_THROWS(list.emplace(list.begin(), -1));
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+
+    for (int i = 0; i < 6; ++i) {
+        list.emplace_back(i);
+    }
+
+    const std::vector<int> expected {0, 1, 2, 3, 4, 5};
+
+    SECTION("into a node with room") {
+        auto pos = std::next(list.begin(), 5);
+        REQUIRE_THROWS(list.emplace(pos, -1));
+        REQUIRE(list.size() == 6U);
+        REQUIRE(valuesOfList(list) == expected);
+    }
+
+    SECTION("into a full node") {
+        auto pos = std::next(list.begin(), 1);
+        REQUIRE_THROWS(list.emplace(pos, -1));
+        REQUIRE(list.size() == 6U);
+        REQUIRE(valuesOfList(list) == expected);
+    }
+
+    list.emplace(std::next(list.begin(), 2), 10);
+    REQUIRE(list.size() == 7U);
+    REQUIRE(valuesOfList(list) == (std::vector<int> {0, 1, 10, 2, 3, 4, 5}));
+}
+
+}  // namespace
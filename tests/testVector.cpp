@@ -21,7 +21,12 @@ limitations under the License.
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
 #include <iterator>
+#include <list>
+#include <vector>
 
 #include <etl/Array.h>
 #include <etl/Vector.h>
@@ -320,6 +325,84 @@ TEMPLATE_TEST_CASE("Etl::Vector<> insert/erase test",
 }
 
 
+int32_t valueOf(int item) {
+    return item;
+}
+
+int32_t valueOf(const ContainerTester& item) {
+    return item.getValue();
+}
+
+
+template<class Vec>
+void testVectorEraseIf() {
+
+    using Item = typename Vec::value_type;
+
+    Vec vec;
+    for (int i = 0; i < 10; ++i) {
+        vec.push_back(Item(i));
+    }
+
+    auto isOdd = [](const Item& item) { return (valueOf(item) % 2) != 0; };
+
+    SECTION("erase_if() with matching elements") {
+
+        auto cnt = Etl::erase_if(vec, isOdd);
+
+        REQUIRE(cnt == 5U);
+        REQUIRE(vec.size() == 5U);
+        for (size_t i = 0; i < vec.size(); ++i) {
+            REQUIRE(vec[i] == Item(2 * i));
+        }
+    }
+
+    SECTION("erase_if() without matching elements") {
+
+        auto cnt = Etl::erase_if(vec, [](const Item& item) { return item < Item(0); });
+
+        REQUIRE(cnt == 0U);
+        REQUIRE(vec.size() == 10U);
+        REQUIRE(vec.back() == Item(9));
+    }
+
+    SECTION("erase_if() with all elements") {
+
+        auto cnt = Etl::erase_if(vec, [](const Item&) { return true; });
+
+        REQUIRE(cnt == 10U);
+        REQUIRE(vec.empty());
+    }
+
+    SECTION("erase_if() calls the predicate once per element") {
+
+        int calls = 0;
+        auto cnt = Etl::erase_if(vec, [&calls](const Item& item) {
+            ++calls;
+            return (valueOf(item) % 4) < 2;
+        });
+
+        REQUIRE(cnt == 6U);
+        REQUIRE(calls == 10);
+        REQUIRE(vec[0] == Item(2));
+        REQUIRE(vec.back() == Item(7));
+    }
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Vector<> erase_if test",
+                   "[vec][etl]",
+                   (Etl::Dynamic::Vector<int>),
+                   (Etl::Static::Vector<int, 16U>),
+                   (Etl::Dynamic::Vector<ContainerTester>),
+                   (Etl::Static::Vector<ContainerTester, 16U>)) {
+
+    testVectorEraseIf<TestType>();
+
+    REQUIRE(ContainerTester::getObjectCount() == 0U);
+}
+
+
 template<class Vec>
 void testVectorAssignment() {
 
@@ -413,6 +496,92 @@ TEST_CASE("Etl::Vector<> swap", "[vector][etl]") {
 }
 
 
+struct WideTrivial {
+    std::uint32_t data[100];
+};
+
+template<class T>
+T makeItem(int i) {
+    return static_cast<T>(i);
+}
+
+template<>
+WideTrivial makeItem<WideTrivial>(int i) {
+    WideTrivial item;
+    for (std::uint32_t& d : item.data) {
+        d = static_cast<std::uint32_t>(i);
+    }
+    return item;
+}
+
+template<class T>
+bool hasItem(const T& item, int i) {
+    return item == makeItem<T>(i);
+}
+
+template<>
+bool hasItem<WideTrivial>(const WideTrivial& item, int i) {
+    return std::all_of(std::begin(item.data), std::end(item.data), [i](std::uint32_t d) {
+        return d == static_cast<std::uint32_t>(i);
+    });
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Vector<> cross-strategy swap of trivial types",
+                   "[vec][static][dynamic][etl]",
+                   std::uint8_t,
+                   std::uint64_t,
+                   WideTrivial) {
+
+    Etl::Static::Vector<TestType, 100U> sv;
+    Etl::Dynamic::Vector<TestType> dv;
+
+    for (int i = 0; i < 70; ++i) {
+        sv.push_back(makeItem<TestType>(i));
+    }
+
+    for (int i = 0; i < 45; ++i) {
+        dv.push_back(makeItem<TestType>(i + 100));
+    }
+
+    sv.swap(dv);
+
+    REQUIRE(sv.size() == 45U);
+    REQUIRE(dv.size() == 70U);
+
+    for (int i = 0; i < 45; ++i) {
+        REQUIRE(hasItem(sv[i], i + 100));
+    }
+
+    for (int i = 0; i < 70; ++i) {
+        REQUIRE(hasItem(dv[i], i));
+    }
+
+    swap(static_cast<Etl::Vector<TestType>&>(dv), static_cast<Etl::Vector<TestType>&>(sv));
+
+    REQUIRE(sv.size() == 70U);
+    REQUIRE(dv.size() == 45U);
+    REQUIRE(hasItem(sv.back(), 69));
+    REQUIRE(hasItem(dv.back(), 144));
+}
+
+
+TEST_CASE("Etl::Dynamic::Vector<> move adopts the buffer", "[vec][dynamic][etl]") {
+
+    Etl::Dynamic::Vector<int> src {1, 2, 3, 4, 5};
+    const int* buffer = src.data();
+
+    Etl::Dynamic::Vector<int> dst;
+    dst = std::move(src);
+
+    REQUIRE(dst.data() == buffer);
+    REQUIRE(dst.size() == 5U);
+
+    Etl::Dynamic::Vector<int> moved(std::move(dst));
+    REQUIRE(moved.data() == buffer);
+}
+
+
 template<class Vec>
 void testVectorLeak() {
 
@@ -746,6 +915,41 @@ TEMPLATE_TEST_CASE("Etl::Vector<> move test",
 }
 
 
+template<class Vec>
+void testVectorInsertWithMove() {
+
+    Vec vec;
+
+    const auto copyCnt = ContainerTester::getCopyCount();
+
+    vec.push_back(ContainerTester(-1));
+    vec.push_front(ContainerTester(-2));
+    vec.emplace_back(ContainerTester(-3));
+    vec.insert(vec.begin() + 1, ContainerTester(-4));
+
+    ContainerTester item(-5);
+    vec.emplace(vec.begin(), std::move(item));
+
+    REQUIRE(ContainerTester::getCopyCount() == copyCnt);
+
+    REQUIRE(vec.size() == 5);
+    REQUIRE(vec[0] == ContainerTester(-5));
+    REQUIRE(vec[1] == ContainerTester(-2));
+    REQUIRE(vec[2] == ContainerTester(-4));
+    REQUIRE(vec[3] == ContainerTester(-1));
+    REQUIRE(vec[4] == ContainerTester(-3));
+}
+
+
+TEMPLATE_TEST_CASE("Etl::Vector<> insert with move",
+                   "[vec][etl]",
+                   (Etl::Dynamic::Vector<ContainerTester>),
+                   (Etl::Static::Vector<ContainerTester, 16U>)) {
+
+    testVectorInsertWithMove<TestType>();
+}
+
+
 template<class SrcVecT, class T = typename SrcVecT::value_type>
 void testVectorAssignToBase(Etl::Vector<T>& dst) {
 
@@ -1144,6 +1348,22 @@ TEST_CASE("Etl::Static::Vector<> constructor test", "[vec][static][etl]") {
 }
 
 
+TEST_CASE("Etl::Static::Vector<> alignment", "[vec][static][etl]") {
+
+    struct alignas(32) OverAligned {
+        double data[3];
+    };
+
+    Etl::Static::Vector<OverAligned, 4> vec1(4);
+    for (const auto& item : vec1) {
+        REQUIRE((reinterpret_cast<std::uintptr_t>(&item) % alignof(OverAligned)) == 0U);
+    }
+
+    Etl::Static::Vector<float, 16, 64> vec2(16);
+    REQUIRE((reinterpret_cast<std::uintptr_t>(vec2.data()) % 64U) == 0U);
+}
+
+
 TEST_CASE("Etl::Static::Vector<> test cleanup", "[vec][static][etl]") {
 
     CHECK(ContainerTester::getObjectCount() == 0);
@@ -1174,6 +1394,48 @@ TEST_CASE("Etl::Custom::Vector<> allocation tests", "[vec][custom][etl]") {
 }
 
 
+TEST_CASE("Etl::Custom::Vector<> range insert allocation", "[vec][custom][etl]") {
+
+    using Etl::Test::DummyAllocator;
+    using VecType = Etl::Custom::Vector<void*, DummyAllocator>;
+    using AllocatorType = VecType::Allocator;
+
+    auto end = AtScopeEnd([]() {
+        REQUIRE(AllocatorType::getDeleteCount() == AllocatorType::getAllocCount());
+        AllocatorType::reset();
+    });
+
+    static const size_t NUM = 20U;
+    static const size_t RESERVED = 24U;
+
+    std::vector<void*> src;
+    for (size_t i = 0; i < NUM; ++i) {
+        src.push_back(reinterpret_cast<void*>(i + 1U));
+    }
+
+    SECTION("with bidirectional iterators") {
+
+        std::list<void*> list(src.begin(), src.end());
+        VecType v(list.begin(), list.end());
+
+        REQUIRE(v.size() == NUM);
+        REQUIRE(std::equal(v.begin(), v.end(), src.begin()));
+        REQUIRE(AllocatorType::getAllocCount() == RESERVED);
+    }
+
+    SECTION("with forward iterators") {
+
+        std::forward_list<void*> list(src.begin(), src.end());
+        VecType v;
+        v.insert(v.end(), list.begin(), list.end());
+
+        REQUIRE(v.size() == NUM);
+        REQUIRE(std::equal(v.begin(), v.end(), src.begin()));
+        REQUIRE(AllocatorType::getAllocCount() == RESERVED);
+    }
+}
+
+
 // Etl::Vector comparision tests -------------------------------------------
 
 
@@ -1317,6 +1579,17 @@ TEMPLATE_TEST_CASE("Etl::Vector<T*> tests",
         REQUIRE(v.back() == &data[6]);
     }
 
+    SECTION("erase_if()") {
+
+        const auto* toErase = &data[4];
+        auto cnt = Etl::erase_if(v, [toErase](const int* item) { return item == toErase; });
+
+        REQUIRE(cnt == 1U);
+        REQUIRE(v.size() == 2U);
+        REQUIRE(v.front() == &data[2]);
+        REQUIRE(v.back() == &data[6]);
+    }
+
     SECTION("V(const V&)") {
 
         OtherType v2(v);